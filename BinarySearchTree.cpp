@@ -2,21 +2,45 @@
     @brief This file contains the definitions for the BinarySearchTree class
  */
 
+#include <algorithm>
 #include "BinarySearchTree.h"
 
 /** Default constructor that sets the root node of the binary search tree to nullptr
  */
 BinarySearchTree::BinarySearchTree() {
     root = nullptr;
+    policy = PLAIN;
+    lazy_erase = false;
+    nodes = 0;
+    splay_period = 8;
+    deep_accesses = 0;
+    tombstones = 0;
 }
 
-/** Overloaded the copy constructor to make a deep copy of the BinarySearchTree object. The constructor uses the copy_node function which sets the left and right children and  the recursive set_parent function to update the parent node pointers.
+/** Constructor that sets the root node of the binary search tree to nullptr and selects how lookups treat the tree
+ @param policy is the Policy (PLAIN or SPLAY) used by the BinarySearchTree object
+ */
+BinarySearchTree::BinarySearchTree(Policy policy) : root(nullptr), policy(policy), lazy_erase(false), nodes(0), splay_period(8), deep_accesses(0), tombstones(0) {
+    
+}
+
+/** Overloaded the copy constructor to make a deep copy of the BinarySearchTree object. The constructor uses the copy_node function which sets the left and right children and  the recursive set_parent function to update the parent node pointers.  The Policy, lazy erase setting, and TreeNodes waiting to be compacted of copy are kept.
  @param copy is a const reference of the BinarySearchTree object that is being copied
  */
 BinarySearchTree::BinarySearchTree(const BinarySearchTree& copy) {
+    policy = copy.policy;
+    lazy_erase = copy.lazy_erase;
+    nodes = copy.nodes;
+    splay_period = copy.splay_period;
+    deep_accesses = 0;
+    tombstones = copy.tombstones;
+    pending = copy.pending;
     root = node_copy(copy.root);
-    root->node_parent = nullptr;
-    set_parent(root);
+    //an empty BinarySearchTree has no root to update
+    if(root != nullptr) {
+        root->node_parent = nullptr;
+        set_parent(root);
+    }
 }
 
 /** Creates a deep copy of a TreeNode object starting from the input pointer.  Recursion is used to cycle through all the left and right children to set them in the new TreeNode object.
@@ -39,6 +63,7 @@ TreeNode* BinarySearchTree::node_copy(const TreeNode* copy) {
         new_node = nullptr;
     }
     new_node->data = copy->data;
+    new_node->erased = copy->erased;
     //recursively calls the node_copy function on the left and right children
     new_node->left = node_copy(copy->left);
     new_node->right = node_copy(copy->right);
@@ -65,11 +90,18 @@ void BinarySearchTree::set_parent(TreeNode* child) {
     }
 }
 
-/** Swap function exchanges pointers between the called BinarySearchTree object and other.
- @param other is the BinarySearchTree object whose root pointer is being swapped
+/** Swap function exchanges pointers and settings between the called BinarySearchTree object and other.
+ @param other is the BinarySearchTree object whose root pointer, policy, and lazy erase state are being swapped
  */
 void BinarySearchTree::swap(BinarySearchTree& other) {
     std::swap(root, other.root);
+    std::swap(policy, other.policy);
+    std::swap(lazy_erase, other.lazy_erase);
+    std::swap(nodes, other.nodes);
+    std::swap(splay_period, other.splay_period);
+    std::swap(deep_accesses, other.deep_accesses);
+    std::swap(tombstones, other.tombstones);
+    pending.swap(other.pending);
 }
 
 /** Overload operator= to use copy and swap idiom to make a deep copy of the BinarySearchTree copy.
@@ -90,7 +122,7 @@ void BinarySearchTree::print() const {
     }
 }
 
-/** Insert a new TreeNode containing input data into the BinarySearchTree.  Use insert_node(TreeNode* new_node) TreeNode function on TreeNode pointer created to recursively find location
+/** Insert a new TreeNode containing input data into the BinarySearchTree.  Use insert_node(TreeNode* new_node) TreeNode function on TreeNode pointer created to recursively find location.  If data is still in a TreeNode that was erased lazily, that TreeNode is reused.
  @param data is the int value of the new TreeNode being added
  */
 void BinarySearchTree::insert(int data) {
@@ -98,6 +130,16 @@ void BinarySearchTree::insert(int data) {
     if(in_tree == 1) {
         return;
     }
+    //if data was erased lazily and not compacted yet, unmark its TreeNode instead of allocating
+    if(tombstones > 0) {
+        std::size_t depth = 0;
+        TreeNode* existing = descend(data, depth);
+        if(existing != nullptr && existing->data == data) {
+            existing->erased = false;
+            --tombstones;
+            return;
+        }
+    }
     
     TreeNode* new_node = nullptr;
     //try to allocate heap memory safely
@@ -113,6 +155,8 @@ void BinarySearchTree::insert(int data) {
     new_node->left = nullptr;
     new_node->right = nullptr;
     new_node->node_parent = nullptr;
+    new_node->erased = false;
+    ++nodes;
     
     //if the BinarySearchTree root is nullptr then set new_node to root
     if(root == nullptr) {
@@ -121,9 +165,19 @@ void BinarySearchTree::insert(int data) {
     else {
         root->insert_node(new_node);
     }
+    //with the SPLAY policy a TreeNode that landed too deep is moved up like a deep lookup
+    if(policy == SPLAY) {
+        std::size_t depth = 0;
+        for(TreeNode* above = new_node->node_parent; above != nullptr; above = above->node_parent) {
+            ++depth;
+        }
+        if(splay_due(depth)) {
+            semi_splay(new_node);
+        }
+    }
 }
 
-/** Counts the number of times the data value is in the BinarySearchTree by using the find(int value) TreeNode recursively to cycle through the BinarySearchTree.
+/** Counts the number of times the data value is in the BinarySearchTree by using the find(int value) TreeNode recursively to cycle through the BinarySearchTree.  With the SPLAY policy the tree is walked with descend instead, and when splay_due allows it the TreeNode that was found (or the last TreeNode visited) is semi-splayed up the tree.  Although count is const, a SPLAY lookup can rotate TreeNodes and change root, so concurrent calls to count on the same SPLAY BinarySearchTree are a data race and need outside locking; PLAIN lookups only read.
  @param data is the int value that is being looked for
  @returns an int 0 or 1 whether or not the input data has been found
  */
@@ -132,6 +186,15 @@ int BinarySearchTree::count(int data) const {
     if(root == nullptr) {
         return 0;
     }
+    //with the SPLAY policy move a deep TreeNode up so the next access is cheaper
+    else if(policy == SPLAY) {
+        std::size_t depth = 0;
+        TreeNode* accessed = descend(data, depth);
+        if(splay_due(depth)) {
+            semi_splay(accessed);
+        }
+        return (accessed->data == data && !accessed->erased) ? 1 : 0;
+    }
     //calls find function recursively to search whether data is in BinarySearchTree
     else if(root->find(data)) {
         return 1;
@@ -142,24 +205,21 @@ int BinarySearchTree::count(int data) const {
     }
 }
 
-/** If input value exists in the BinarySearchTree object, remove that TreeNode and connect appropriate pointers.  For TreeNodes with two children, use the largest child of left subtree and update node_parent.
+/** If input value exists in the BinarySearchTree object, remove that TreeNode with the unlink function.  With lazy erase turned on, the TreeNode is only marked as erased and is reclaimed later by compact.
  @param data is the int value of the TreeNode being removed
  */
 void BinarySearchTree::erase(int data) {
     //find node that is going to be removed
     TreeNode* to_be_removed = root;
-    TreeNode* parent = nullptr;
     bool found = false;
     //loop through BinarySearchTree as long as data has not been found and nullptr not reached
     while((!found) && (to_be_removed != nullptr)) {
         //if data is larger update TreeNode pointers to go to the right
         if(to_be_removed->data < data) {
-            parent = to_be_removed;
             to_be_removed = to_be_removed->right;
         }
         //if data is smaller update TreeNode pointers to go to the left
-        if(to_be_removed->data > data) {
-            parent = to_be_removed;
+        else if(to_be_removed->data > data) {
             to_be_removed = to_be_removed->left;
         }
         //else data is equal and found is set to true
@@ -171,49 +231,56 @@ void BinarySearchTree::erase(int data) {
     if(!found) {
         return;
     }
-    
+    //with lazy erase, mark the TreeNode and leave the unlinking to compact
+    if(lazy_erase) {
+        if(!to_be_removed->erased) {
+            to_be_removed->erased = true;
+            ++tombstones;
+            pending.push_back(data);
+        }
+        return;
+    }
+    unlink(to_be_removed);
+}
+
+/** Removes a TreeNode from the BinarySearchTree and connects appropriate pointers.  For TreeNodes with two children, use the largest child of left subtree and update node_parent.
+ @param to_be_removed is a pointer to the TreeNode being removed
+ */
+void BinarySearchTree::unlink(TreeNode* to_be_removed) {
+    TreeNode* parent = to_be_removed->node_parent;
+    //a TreeNode waiting to be compacted is no longer waiting once it is removed
+    if(to_be_removed->erased) {
+        --tombstones;
+    }
+    --nodes;
     //to_be_removed contains data, if one of the children is empty, use the other
-    if((to_be_removed->left = nullptr) || (to_be_removed->right = nullptr)) {
+    if((to_be_removed->left == nullptr) || (to_be_removed->right == nullptr)) {
         TreeNode* new_child;
-        //if left is nullptr and right is not, can only be in right, set new_child to to_be_removed->right
-        if((to_be_removed->left == nullptr) && (to_be_removed->right != nullptr)) {
+        //if left is nullptr, children can only exist in the right (or there are none)
+        if(to_be_removed->left == nullptr) {
             new_child = to_be_removed->right;
-            delete to_be_removed;
         }
-        //if right is nullptr and left is not, children can only exist in the left, set new_child to to_be_removed->left
-        else if((to_be_removed->right == nullptr) && (to_be_removed->left != nullptr)) {
+        //else right is nullptr, children can only exist in the left
+        else {
             new_child = to_be_removed->left;
-            delete to_be_removed;
         }
-        //else both left and right are nullptr to_be_removed is end TreeNode
-        else {
-            new_child = nullptr;
-            //if the left child is being removed, set it to nullptr
-            if(parent->left == to_be_removed) {
-                parent->left = new_child;
-                delete to_be_removed;
-            }
-            //else right child is being removed, set it to nullptr
-            else {
-                parent->right = new_child;
-                delete to_be_removed;
-            }
-            return;
+        //new_child takes the place of to_be_removed, so its node_parent is the old parent
+        if(new_child != nullptr) {
+            new_child->node_parent = parent;
         }
         //found in root
         if(parent == nullptr) {
             root = new_child;
         }
-        //if left child is being removed, set it to new_child and update node_parent
+        //if left child is being removed, set it to new_child
         else if(parent->left == to_be_removed) {
             parent->left = new_child;
-            parent->left->node_parent = parent;
         }
-        //if right child is being removed, set it to new_child and update node_parent
+        //if right child is being removed, set it to new_child
         else {
             parent->right = new_child;
-            parent->right->node_parent = parent;
         }
+        delete to_be_removed;
         return;
     }
     //neither subtree is empty, find largest element of left subtree
@@ -226,40 +293,37 @@ void BinarySearchTree::erase(int data) {
     }
     //largest contains largest child in left subtree, move the content and unlink child
     to_be_removed->data = largest->data;
+    to_be_removed->erased = largest->erased;
     //if largest parent is being removed, set its left to largest->left
     if(largest_parent == to_be_removed) {
         largest_parent->left = largest->left;
-        delete largest;
     }
     //if largest parent is not removed, set its right to largest->left
     else {
         largest_parent->right = largest->left;
-        delete largest;
     }
+    //the left child of largest moved up, so its node_parent is now largest_parent
+    if(largest->left != nullptr) {
+        largest->left->node_parent = largest_parent;
+    }
+    delete largest;
 }
 
-/** Determines the smallest int value contained within the BinarySearchTree
+/** Determines the smallest int value contained within the BinarySearchTree, skipping TreeNodes that were erased lazily
  @returns the int value of the smallest TreeNode
  */
 int BinarySearchTree::smallest() {
-    TreeNode* smallest_value = root;
-    //cycles through BinarySearchTree to the left until it reaches the smallest value
-    while(smallest_value->left != nullptr) {
-        smallest_value = smallest_value->left;
-    }
-    return smallest_value->data;
+    return *begin();
 }
 
-/** Determines the largest int value conained within the BinarySearchTree
+/** Determines the largest int value conained within the BinarySearchTree, skipping TreeNodes that were erased lazily
  @returns the int value of the largest TreeNode
  */
 int BinarySearchTree::largest() {
-    TreeNode* largest_value = root;
-    //cycles through BinarySearchTree to the right until it reaches the largest value
-    while(largest_value != nullptr) {
-        largest_value = largest_value->right;
-    }
-    return largest_value->data;
+    TreeIterator largest_value = end();
+    //one step back from one past the largest TreeNode is the largest TreeNode
+    --largest_value;
+    return *largest_value;
 }
 
 /** Creates a TreeIterator object that points to the first (smallest) TreeNode in the BinarySearchTree
@@ -270,10 +334,14 @@ TreeIterator BinarySearchTree::begin() {
     begin.container = this;
     TreeNode* smallest_value = root;
     //cycles through BinarySearchTree to the left until it reaches the smallest value
-    while(smallest_value->left != nullptr) {
+    while(smallest_value != nullptr && smallest_value->left != nullptr) {
         smallest_value = smallest_value->left;
     }
     begin.node_pointer = smallest_value;
+    //if the smallest TreeNode was erased lazily, move on to the first one that was not
+    if(smallest_value != nullptr && smallest_value->erased) {
+        ++begin;
+    }
     return begin;
 }
 
@@ -283,17 +351,375 @@ TreeIterator BinarySearchTree::begin() {
 TreeIterator BinarySearchTree::end() {
     TreeIterator end;
     end.container = this;
-    TreeNode* largest_value = root;
-    //cycles through BinarySearchTree to the right until it reaches the largest value
-    while(largest_value->right != nullptr) {
-        largest_value = largest_value->right;
-    }
-    largest_value = largest_value->right;
-    end.node_pointer = largest_value;
+    //one past the largest TreeNode is always nullptr (the right child of the largest TreeNode)
+    end.node_pointer = nullptr;
     return end;
 }
 
-/** Cycles through TreeNodes of a BinarySearchTree and calls delete recursively.
+/** Sets the Policy used by lookups.  The shape of the tree is kept, so the policy can be changed at any time.
+ @param new_policy is the Policy (PLAIN or SPLAY) that is used from now on
+ */
+void BinarySearchTree::set_policy(Policy new_policy) {
+    policy = new_policy;
+}
+
+/** Gives the Policy used by lookups
+ @returns the Policy (PLAIN or SPLAY) of the BinarySearchTree object
+ */
+BinarySearchTree::Policy BinarySearchTree::get_policy() const {
+    return policy;
+}
+
+/** Walks down from the root using the properties of the BinarySearchTree without changing its shape
+ @param data is the int value that is being looked for
+ @param depth is a reference set to the number of steps taken below the root to reach the returned TreeNode
+ @returns a pointer to the TreeNode containing data, or to the last TreeNode visited if data is not in the BinarySearchTree (nullptr only when the BinarySearchTree is empty)
+ */
+TreeNode* BinarySearchTree::descend(int data, std::size_t& depth) const {
+    TreeNode* current = root;
+    TreeNode* last = nullptr;
+    depth = 0;
+    //cycle down until data is found or nullptr is reached
+    while(current != nullptr && current->data != data) {
+        last = current;
+        ++depth;
+        //if data is smaller go left, otherwise go right
+        if(data < current->data) {
+            current = current->left;
+        }
+        else {
+            current = current->right;
+        }
+    }
+    //if data was found return its TreeNode, else the last TreeNode visited (one step less deep)
+    if(current != nullptr) {
+        return current;
+    }
+    if(depth > 0) {
+        --depth;
+    }
+    return last;
+}
+
+/** Sets how often the SPLAY policy moves up a TreeNode that was reached deeper than log2 n.  A period of 1 moves up every deep access, while a period of k moves up one deep access in k, which keeps the rotations of uniform lookups low while values used again and again still climb after a few accesses.
+ @param period is the number of deep accesses for each one that is moved up, 0 is treated as 1
+ */
+void BinarySearchTree::set_splay_period(std::size_t period) {
+    splay_period = (period == 0) ? 1 : period;
+}
+
+/** Gives how often the SPLAY policy moves up a deep access
+ @returns the number of deep accesses for each one that is moved up
+ */
+std::size_t BinarySearchTree::get_splay_period() const {
+    return splay_period;
+}
+
+/** Decides whether an access at the given depth is moved up by the SPLAY policy.  A balanced tree of n TreeNodes is about log2 n deep, so only accesses deeper than log2 n count, and of those only one in splay_period is moved up.
+ @param depth is the number of steps below the root of the TreeNode that was accessed
+ @returns true if the TreeNode should be semi-splayed
+ */
+bool BinarySearchTree::splay_due(std::size_t depth) const {
+    std::size_t log2 = 0;
+    //count how many times the number of TreeNodes can be halved
+    for(std::size_t n = nodes; n > 1; n >>= 1) {
+        ++log2;
+    }
+    //accesses near the root are left alone, rotating them would cost more than it saves
+    if(depth <= log2) {
+        return false;
+    }
+    ++deep_accesses;
+    return deep_accesses % splay_period == 0;
+}
+
+/** Rotates the right child of node up into the position of node, updating left, right, and node_parent pointers (and root if node was the root)
+ @param node is a pointer to the TreeNode that becomes the left child of its right child
+ */
+void BinarySearchTree::rotate_left(TreeNode* node) const {
+    TreeNode* child = node->right;
+    //the left subtree of child moves over to become the right subtree of node
+    node->right = child->left;
+    if(child->left != nullptr) {
+        child->left->node_parent = node;
+    }
+    //child takes the place of node under its parent
+    child->node_parent = node->node_parent;
+    if(node->node_parent == nullptr) {
+        root = child;
+    }
+    else if(node->node_parent->left == node) {
+        node->node_parent->left = child;
+    }
+    else {
+        node->node_parent->right = child;
+    }
+    child->left = node;
+    node->node_parent = child;
+}
+
+/** Rotates the left child of node up into the position of node, updating left, right, and node_parent pointers (and root if node was the root)
+ @param node is a pointer to the TreeNode that becomes the right child of its left child
+ */
+void BinarySearchTree::rotate_right(TreeNode* node) const {
+    TreeNode* child = node->left;
+    //the right subtree of child moves over to become the left subtree of node
+    node->left = child->right;
+    if(child->right != nullptr) {
+        child->right->node_parent = node;
+    }
+    //child takes the place of node under its parent
+    child->node_parent = node->node_parent;
+    if(node->node_parent == nullptr) {
+        root = child;
+    }
+    else if(node->node_parent->left == node) {
+        node->node_parent->left = child;
+    }
+    else {
+        node->node_parent->right = child;
+    }
+    child->right = node;
+    node->node_parent = child;
+}
+
+/** Moves node up with semi-splaying: a zig-zag lifts node two levels like in a splay tree, while a zig-zig only rotates its parent over the grandparent and carries on from the parent.  Every TreeNode on the access path ends up about half as deep as before, node gets roughly halfway to the root, and it takes about half the rotations of a full splay.  Values that are used again and again keep climbing on later deep accesses.
+ @param node is a pointer to the TreeNode being moved up, nothing is done if it is nullptr
+ */
+void BinarySearchTree::semi_splay(TreeNode* node) const {
+    //if TreeNode pointer is nullptr, there is nothing to move up
+    while(node != nullptr && node->node_parent != nullptr) {
+        TreeNode* parent = node->node_parent;
+        TreeNode* grandparent = parent->node_parent;
+        //zig: parent is the root, a single rotation finishes
+        if(grandparent == nullptr) {
+            if(parent->left == node) {
+                rotate_right(parent);
+            }
+            else {
+                rotate_left(parent);
+            }
+            return;
+        }
+        //zig-zig: node and parent are both left children, lift parent and carry on from it
+        else if(grandparent->left == parent && parent->left == node) {
+            rotate_right(grandparent);
+            node = parent;
+        }
+        //zig-zig: node and parent are both right children, lift parent and carry on from it
+        else if(grandparent->right == parent && parent->right == node) {
+            rotate_left(grandparent);
+            node = parent;
+        }
+        //zig-zag: node is a right child of a left child
+        else if(parent->right == node) {
+            rotate_left(parent);
+            rotate_right(grandparent);
+        }
+        //zig-zag: node is a left child of a right child
+        else {
+            rotate_right(parent);
+            rotate_left(grandparent);
+        }
+    }
+}
+
+/** Turns lazy erase on or off.  While it is on, erase(int data) only marks TreeNodes as erased.  Turning it off compacts every TreeNode that is still marked.
+ @param lazy is true to mark TreeNodes on erase and false to remove them right away
+ */
+void BinarySearchTree::set_lazy_erase(bool lazy) {
+    lazy_erase = lazy;
+    //when lazy erase is turned off nothing should be left waiting
+    if(!lazy_erase && tombstones > 0) {
+        compact(tombstones);
+    }
+}
+
+/** Gives whether lazy erase is turned on
+ @returns true if erase(int data) only marks TreeNodes as erased
+ */
+bool BinarySearchTree::get_lazy_erase() const {
+    return lazy_erase;
+}
+
+/** Physically removes TreeNodes that were erased lazily, at most batch of them per call.  Every value marked by erase is kept in a list, so compact takes values off that list and looks each one up instead of walking the tree for marked TreeNodes: a call costs O(batch log n) in a balanced BinarySearchTree no matter how many TreeNodes are not marked.  Values that were inserted again or removed by another erase since they were marked are skipped without counting toward batch.  A call only returns 0 when no TreeNode is waiting (or batch is 0), so compact can be called until it returns 0.
+ @param batch is the largest number of TreeNodes that are reclaimed
+ @returns the number of TreeNodes that were reclaimed
+ */
+std::size_t BinarySearchTree::compact(std::size_t batch) {
+    std::size_t reclaimed = 0;
+    //cycle through the waiting values until the batch is full or none are left
+    while(reclaimed < batch && !pending.empty()) {
+        int data = pending.back();
+        pending.pop_back();
+        std::size_t depth = 0;
+        TreeNode* marked = descend(data, depth);
+        //only remove the TreeNode if it is still there and still marked
+        if(marked != nullptr && marked->data == data && marked->erased) {
+            unlink(marked);
+            ++reclaimed;
+        }
+    }
+    //once no TreeNode is waiting, anything left in the list is out of date
+    if(tombstones == 0) {
+        pending.clear();
+    }
+    return reclaimed;
+}
+
+/** Removes every int value from lo to hi (inclusive) in a single walk of the tree.  The walk stops at the first TreeNode inside the range, the TreeNodes of the range below it are cut off with whole subtrees deleted at once, and what is left of the two sides is joined back together.  This takes O(k + log n) for k removed TreeNodes in a balanced BinarySearchTree.  TreeNodes are always removed right away, even with lazy erase turned on.
+ @param lo is the smallest int value being removed
+ @param hi is the largest int value being removed
+ */
+void BinarySearchTree::erase(int lo, int hi) {
+    //an empty range removes nothing
+    if(lo > hi) {
+        return;
+    }
+    TreeNode* split = root;
+    //cycle down until a TreeNode inside the range is reached
+    while(split != nullptr && (split->data < lo || hi < split->data)) {
+        //if the value is below the range go right
+        if(split->data < lo) {
+            split = split->right;
+        }
+        //else the value is above the range go left
+        else {
+            split = split->left;
+        }
+    }
+    //if no TreeNode is inside the range there is nothing to remove
+    if(split == nullptr) {
+        return;
+    }
+    //everything left of split that survives is below lo, everything right of split that survives is above hi
+    TreeNode* below = drop_from(split->left, lo);
+    TreeNode* above = drop_to(split->right, hi);
+    TreeNode* joined = below;
+    //if nothing survived below, the part above takes the place of split
+    if(below == nullptr) {
+        joined = above;
+    }
+    //else hang the part above off the largest TreeNode of the part below
+    else if(above != nullptr) {
+        TreeNode* largest_below = below;
+        while(largest_below->right != nullptr) {
+            largest_below = largest_below->right;
+        }
+        largest_below->right = above;
+        above->node_parent = largest_below;
+    }
+    //joined takes the place of split under its parent
+    TreeNode* parent = split->node_parent;
+    if(joined != nullptr) {
+        joined->node_parent = parent;
+    }
+    if(parent == nullptr) {
+        root = joined;
+    }
+    else if(parent->left == split) {
+        parent->left = joined;
+    }
+    else {
+        parent->right = joined;
+    }
+    split->left = nullptr;
+    split->right = nullptr;
+    recursive_destructor(split);
+}
+
+/** Removes every int value in keys with a single walk of the tree instead of one descent per value.  TreeNodes are always removed right away, even with lazy erase turned on.
+ @param keys is a const reference to the int values being removed, sorted from smallest to largest
+ */
+void BinarySearchTree::erase_many(const std::vector<int>& keys) {
+    //removing an empty list would leave the BinarySearchTree unchanged
+    if(keys.empty()) {
+        return;
+    }
+    erase_sorted(root, &keys[0], &keys[0] + keys.size());
+}
+
+/** Cuts every TreeNode with an int value of at least lo out of the subtree starting at node.  Each TreeNode that is cut takes its whole right subtree with it, so only one path down the subtree is walked.
+ @param node is a pointer to the top of the subtree being cut
+ @param lo is the smallest int value being removed
+ @returns a pointer to the top of what is left of the subtree (its node_parent is left for the caller to set)
+ */
+TreeNode* BinarySearchTree::drop_from(TreeNode* node, int lo) {
+    TreeNode* top = node;
+    TreeNode** link = &top;
+    TreeNode* parent = nullptr;
+    //cycle down until nullptr is reached
+    while(*link != nullptr) {
+        TreeNode* current = *link;
+        //if current is removed, its left child takes its place and current goes with its right subtree
+        if(lo <= current->data) {
+            *link = current->left;
+            if(current->left != nullptr) {
+                current->left->node_parent = parent;
+            }
+            current->left = nullptr;
+            recursive_destructor(current);
+        }
+        //else current stays and only its right subtree can hold values being removed
+        else {
+            parent = current;
+            link = &current->right;
+        }
+    }
+    return top;
+}
+
+/** Cuts every TreeNode with an int value of at most hi out of the subtree starting at node.  Each TreeNode that is cut takes its whole left subtree with it, so only one path down the subtree is walked.
+ @param node is a pointer to the top of the subtree being cut
+ @param hi is the largest int value being removed
+ @returns a pointer to the top of what is left of the subtree (its node_parent is left for the caller to set)
+ */
+TreeNode* BinarySearchTree::drop_to(TreeNode* node, int hi) {
+    TreeNode* top = node;
+    TreeNode** link = &top;
+    TreeNode* parent = nullptr;
+    //cycle down until nullptr is reached
+    while(*link != nullptr) {
+        TreeNode* current = *link;
+        //if current is removed, its right child takes its place and current goes with its left subtree
+        if(current->data <= hi) {
+            *link = current->right;
+            if(current->right != nullptr) {
+                current->right->node_parent = parent;
+            }
+            current->right = nullptr;
+            recursive_destructor(current);
+        }
+        //else current stays and only its left subtree can hold values being removed
+        else {
+            parent = current;
+            link = &current->left;
+        }
+    }
+    return top;
+}
+
+/** Recursively removes the TreeNodes whose int values are in the sorted list from first to last.  The list is split at each TreeNode so every subtree is only visited with the values that can be inside it, and a TreeNode is unlinked after both of its subtrees are done.
+ @param node is a pointer to the top of the subtree being walked
+ @param first is a pointer to the smallest int value left to remove in this subtree
+ @param last is a pointer to one past the largest int value left to remove in this subtree
+ */
+void BinarySearchTree::erase_sorted(TreeNode* node, const int* first, const int* last) {
+    //if TreeNode pointer is nullptr or no values are left, there is nothing to remove in that direction
+    if(node == nullptr || first == last) {
+        return;
+    }
+    const int* middle = std::lower_bound(first, last, node->data);
+    const int* after = std::upper_bound(middle, last, node->data);
+    erase_sorted(node->left, first, middle);
+    erase_sorted(node->right, after, last);
+    //if the value of node is in the list, remove it now that its subtrees are done
+    if(middle != after) {
+        unlink(node);
+    }
+}
+
+/** Cycles through TreeNodes of a BinarySearchTree and calls delete recursively.  The counts of TreeNodes and of TreeNodes waiting to be compacted go down as they are deleted.
  @param node is a pointer to the TreeNode whose children are being cycled through and deleted
  */
 void BinarySearchTree::recursive_destructor(TreeNode* node) {
@@ -303,6 +729,10 @@ void BinarySearchTree::recursive_destructor(TreeNode* node) {
     }
     recursive_destructor(node->left);
     recursive_destructor(node->right);
+    if(node->erased) {
+        --tombstones;
+    }
+    --nodes;
     delete node;
 }
 
@@ -8,18 +8,25 @@
 #define BINARYSEARCHTREE_H
 
 #include <iostream>
+#include <vector>
+#include <cstddef>
 #include "TreeNode.h"
 #include "TreeIterator.h"
 
 /** @class BinarySearchTree
-    @brief The BinarySearchTree class creates a Binary Search Tree of int values.  The BinarySearchTree class contains a pointer to its root TreeNode object (which has pointers to its left, right, and parent neighbors in the binary search tree).  Functions have been added to add new int values to the tree, delete int values, determine whether an int value is in the tree, and also provides the smallest and largest int values of the BinarySearchTree object.  A copt and swap idiom was implemented to make a deep copy of the binary search tree, and a recursive iterator was used to go through all the TreeNode objects. The BinarySearchTree class has friendship with the TreeIterator class allowing the BinarySearchTree class to access the variables and functions of the TreeIterator class.
+    @brief The BinarySearchTree class creates a Binary Search Tree of int values.  The BinarySearchTree class contains a pointer to its root TreeNode object (which has pointers to its left, right, and parent neighbors in the binary search tree).  Functions have been added to add new int values to the tree, delete int values, determine whether an int value is in the tree, and also provides the smallest and largest int values of the BinarySearchTree object.  A copt and swap idiom was implemented to make a deep copy of the binary search tree, and a recursive iterator was used to go through all the TreeNode objects. The BinarySearchTree class has friendship with the TreeIterator class allowing the BinarySearchTree class to access the variables and functions of the TreeIterator class.  Each BinarySearchTree object also has a Policy; with the SPLAY policy, count and insert semi-splay a TreeNode that was reached deeper than log2 n (one deep access in every splay_period, 8 by default), which repairs badly shaped trees and lets values that are looked up again and again climb toward the root, while accesses near the root cost no rotations.  Because of this a SPLAY lookup writes to the tree even though count is const (root and the TreeNode links are changed through the mutable root), so a SPLAY BinarySearchTree is not safe for several threads reading it at the same time, while a PLAIN one is.  Whole ranges or sorted lists of values can be erased in a single walk of the tree, and with lazy erase turned on erase only marks TreeNodes (and keeps a list of their values) so that compact can reclaim them later in batches.
  
  */
 
 class BinarySearchTree {
 public:
+    /** Policy selects what lookups do to the shape of the tree.  PLAIN leaves the tree untouched, SPLAY semi-splays some of the TreeNodes reached deeper than log2 n so repeatedly used values move up toward the root.
+     */
+    enum Policy { PLAIN, SPLAY };
+    
     //Constructors
     BinarySearchTree();
+    explicit BinarySearchTree(Policy policy);
     BinarySearchTree(const BinarySearchTree& copy);
     
     //Other functions
@@ -30,12 +37,21 @@ public:
     
     void insert(int data);
     void erase(int data);
+    void erase(int lo, int hi);
+    void erase_many(const std::vector<int>& keys);
     int count(int data) const;
     void print() const;
     int smallest();
     int largest();
     TreeIterator begin();
     TreeIterator end();
+    void set_policy(Policy new_policy);
+    Policy get_policy() const;
+    void set_lazy_erase(bool lazy);
+    bool get_lazy_erase() const;
+    std::size_t compact(std::size_t batch);
+    void set_splay_period(std::size_t period);
+    std::size_t get_splay_period() const;
     
     void recursive_destructor(TreeNode* node);
     
@@ -46,7 +62,25 @@ public:
     }
     
 private:
-    TreeNode* root;
+    TreeNode* descend(int data, std::size_t& depth) const;
+    bool splay_due(std::size_t depth) const;
+    void rotate_left(TreeNode* node) const;
+    void rotate_right(TreeNode* node) const;
+    void semi_splay(TreeNode* node) const;
+    void unlink(TreeNode* to_be_removed);
+    TreeNode* drop_from(TreeNode* node, int lo);
+    TreeNode* drop_to(TreeNode* node, int hi);
+    void erase_sorted(TreeNode* node, const int* first, const int* last);
+    
+    //mutable so the const count can splay with the SPLAY policy
+    mutable TreeNode* root;
+    Policy policy;
+    bool lazy_erase;
+    std::size_t nodes;
+    std::size_t splay_period;
+    mutable std::size_t deep_accesses;
+    std::size_t tombstones;
+    std::vector<int> pending;
     friend class TreeIterator;
 };
 
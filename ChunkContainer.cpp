@@ -0,0 +1,702 @@
+/** @file ChunkContainer.cpp
+ @brief This file contains the definitions for the ChunkContainer class
+ */
+
+#include <algorithm>
+#include <iterator>
+#include "ChunkContainer.h"
+//GCC and Clang on x86 can compile single functions for AVX2 or POPCNT without -mavx2 or -mpopcnt, and ask the CPU which one to use when the program runs
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CHUNKCONTAINER_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+//an ARRAY holding more values than this takes more room than a BITMAP
+const int ARRAY_LIMIT = 4096;
+//a BITMAP has one bit for each of the 65536 values, stored in 64 bit words
+const int BITMAP_WORDS = 1024;
+
+/** Counts the bits that are set in a word with whatever this build targets.  The builtin is only used when the target is known to have a popcount instruction (-mpopcnt, -msse4.2, -march=native, or any ARM64), since otherwise GCC compiles it into a call to the library function __popcountdi2.  Without the instruction the bits are added up in parallel inside the word, which takes a dozen shifts, masks, and adds and no branches or calls.
+ @param word is the 64 bit word being counted
+ @returns the number of bits set in word
+ */
+static int bit_count(std::uint64_t word) {
+#if defined(__POPCNT__) || defined(__aarch64__)
+    return __builtin_popcountll(word);
+#else
+    //count the bits of every 2 bit, then 4 bit, then 8 bit group, then add up the 8 bytes with a multiply
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/** ANDs two BITMAPs word by word and counts the bits of the result in the same pass, one word at a time with bit_count
+ @param left is a pointer to the BITMAP_WORDS words of the first BITMAP
+ @param right is a pointer to the BITMAP_WORDS words of the second BITMAP
+ @param result is a pointer to BITMAP_WORDS words that receive the AND, or nullptr if only the count is wanted
+ @returns the number of bits set in both BITMAPs
+ */
+static int and_count_scalar(const std::uint64_t* left, const std::uint64_t* right, std::uint64_t* result) {
+    int total = 0;
+    for(int word = 0; word < BITMAP_WORDS; ++word) {
+        std::uint64_t both = left[word] & right[word];
+        if(result != nullptr) {
+            result[word] = both;
+        }
+        total += bit_count(both);
+    }
+    return total;
+}
+
+#if defined(CHUNKCONTAINER_X86_DISPATCH)
+/** Same as and_count_scalar, compiled for CPUs with the POPCNT instruction so each word is counted with a single instruction
+ @param left is a pointer to the BITMAP_WORDS words of the first BITMAP
+ @param right is a pointer to the BITMAP_WORDS words of the second BITMAP
+ @param result is a pointer to BITMAP_WORDS words that receive the AND, or nullptr if only the count is wanted
+ @returns the number of bits set in both BITMAPs
+ */
+__attribute__((target("popcnt")))
+static int and_count_popcnt(const std::uint64_t* left, const std::uint64_t* right, std::uint64_t* result) {
+    int total = 0;
+    for(int word = 0; word < BITMAP_WORDS; ++word) {
+        std::uint64_t both = left[word] & right[word];
+        if(result != nullptr) {
+            result[word] = both;
+        }
+        total += __builtin_popcountll(both);
+    }
+    return total;
+}
+
+/** Same as and_count_scalar, compiled for CPUs with AVX2 so four words are handled per step: the bytes are counted with a 16 entry table lookup on each half byte (VPSHUFB) and summed with VPSADBW
+ @param left is a pointer to the BITMAP_WORDS words of the first BITMAP
+ @param right is a pointer to the BITMAP_WORDS words of the second BITMAP
+ @param result is a pointer to BITMAP_WORDS words that receive the AND, or nullptr if only the count is wanted
+ @returns the number of bits set in both BITMAPs
+ */
+__attribute__((target("avx2")))
+static int and_count_avx2(const std::uint64_t* left, const std::uint64_t* right, std::uint64_t* result) {
+    //number of bits set in each value of a half byte
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_half = _mm256_set1_epi8(0x0F);
+    __m256i totals = _mm256_setzero_si256();
+    for(int word = 0; word < BITMAP_WORDS; word += 4) {
+        __m256i both = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + word)),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + word)));
+        if(result != nullptr) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + word), both);
+        }
+        //count each byte from its two half bytes, then add the bytes into the four 64 bit totals
+        __m256i bytes = _mm256_add_epi8(_mm256_shuffle_epi8(table, _mm256_and_si256(both, low_half)),
+                                        _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(both, 4), low_half)));
+        totals = _mm256_add_epi64(totals, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+    }
+    return static_cast<int>(_mm256_extract_epi64(totals, 0) + _mm256_extract_epi64(totals, 1) +
+                            _mm256_extract_epi64(totals, 2) + _mm256_extract_epi64(totals, 3));
+}
+#endif
+
+/** Default constructor that creates an empty ARRAY ChunkContainer
+ */
+ChunkContainer::ChunkContainer() : kind(ARRAY), count_values(0) {
+    
+}
+
+/** Counts the bits that are set in a word
+ @param word is the 64 bit word being counted
+ @returns the number of bits set in word
+ */
+int ChunkContainer::popcount(std::uint64_t word) {
+    return bit_count(word);
+}
+
+/** ANDs two BITMAPs word by word and counts the bits of the result in the same pass.  On x86 with GCC or Clang the CPU is asked once, the first time this is called, whether it has AVX2 or POPCNT, and the fastest of and_count_avx2, and_count_popcnt, and and_count_scalar is used, so no -mavx2 or -mpopcnt flag is needed.  Other compilers and CPUs use and_count_scalar.
+ @param left is a pointer to the BITMAP_WORDS words of the first BITMAP
+ @param right is a pointer to the BITMAP_WORDS words of the second BITMAP
+ @param result is a pointer to BITMAP_WORDS words that receive the AND, or nullptr if only the count is wanted
+ @returns the number of bits set in both BITMAPs
+ */
+int ChunkContainer::and_count(const std::uint64_t* left, const std::uint64_t* right, std::uint64_t* result) {
+#if defined(CHUNKCONTAINER_X86_DISPATCH)
+    //2 for AVX2, 1 for POPCNT, 0 for neither
+    static const int level = __builtin_cpu_supports("avx2") ? 2 : (__builtin_cpu_supports("popcnt") ? 1 : 0);
+    if(level == 2) {
+        return and_count_avx2(left, right, result);
+    }
+    if(level == 1) {
+        return and_count_popcnt(left, right, result);
+    }
+#endif
+    return and_count_scalar(left, right, result);
+}
+
+/** Finds the position of the lowest bit that is set in a word
+ @param word is the 64 bit word being searched, must not be 0
+ @returns the position (0 to 63) of the lowest set bit
+ */
+int ChunkContainer::lowest_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int position = 0;
+    //shift right until the lowest bit is set
+    while((word & 1) == 0) {
+        word >>= 1;
+        ++position;
+    }
+    return position;
+#endif
+}
+
+/** Finds the position of the highest bit that is set in a word
+ @param word is the 64 bit word being searched, must not be 0
+ @returns the position (0 to 63) of the highest set bit
+ */
+int ChunkContainer::highest_bit(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(word);
+#else
+    int position = 63;
+    //shift left until the highest bit is set
+    while((word >> 63) == 0) {
+        word <<= 1;
+        --position;
+    }
+    return position;
+#endif
+}
+
+/** Determines whether a value is in the ChunkContainer
+ @param value is the low 16 bits of the int value being looked for
+ @returns bool value of true if value is in the ChunkContainer and false if it is not
+ */
+bool ChunkContainer::contains(std::uint16_t value) const {
+    //ARRAY values are sorted, so use a binary search
+    if(kind == ARRAY) {
+        return std::binary_search(values.begin(), values.end(), value);
+    }
+    //BITMAP checks the bit of value
+    else if(kind == BITMAP) {
+        return ((bits[value >> 6] >> (value & 63)) & 1) != 0;
+    }
+    //RUN checks whether value is inside the last run starting at or before it
+    else {
+        int run = run_index(value);
+        return (run >= 0) && (value <= values[2 * run] + values[2 * run + 1]);
+    }
+}
+
+/** Adds a value to the ChunkContainer.  A RUN ChunkContainer grows the run next to value (merging two runs that value joins) or starts a new run, and an ARRAY that is full becomes a BITMAP.
+ @param value is the low 16 bits of the int value being added
+ @returns bool value of true if value was added and false if it was already in the ChunkContainer
+ */
+bool ChunkContainer::insert_value(std::uint16_t value) {
+    //if value is already in the ChunkContainer, do not add
+    if(contains(value)) {
+        return false;
+    }
+    //RUN edits the runs around value in place
+    if(kind == RUN) {
+        int run = run_index(value);
+        int following = run + 1;
+        bool joins_before = (run >= 0) && (values[2 * run] + values[2 * run + 1] + 1 == value);
+        bool joins_after = (2 * following < static_cast<int>(values.size())) && (values[2 * following] == value + 1);
+        //if value fills the gap between two runs, they become one run
+        if(joins_before && joins_after) {
+            values[2 * run + 1] = static_cast<std::uint16_t>(values[2 * following] + values[2 * following + 1] - values[2 * run]);
+            values.erase(values.begin() + 2 * following, values.begin() + 2 * following + 2);
+        }
+        //if value is just after a run, that run gets longer
+        else if(joins_before) {
+            ++values[2 * run + 1];
+        }
+        //if value is just before a run, that run starts at value
+        else if(joins_after) {
+            values[2 * following] = value;
+            ++values[2 * following + 1];
+        }
+        //else value is a new run of length one
+        else {
+            std::uint16_t single[] = { value, 0 };
+            values.insert(values.begin() + 2 * following, single, single + 2);
+        }
+        ++count_values;
+        fit_runs();
+        return true;
+    }
+    //a full ARRAY would be larger than a BITMAP
+    if(kind == ARRAY && count_values >= ARRAY_LIMIT) {
+        to_bitmap();
+    }
+    //ARRAY keeps values sorted
+    if(kind == ARRAY) {
+        values.insert(std::lower_bound(values.begin(), values.end(), value), value);
+    }
+    //BITMAP sets the bit of value
+    else {
+        bits[value >> 6] |= std::uint64_t(1) << (value & 63);
+    }
+    ++count_values;
+    return true;
+}
+
+/** Removes a value from the ChunkContainer.  A RUN ChunkContainer shortens the run holding value (splitting it in two when value is in the middle), and a BITMAP turns back into an ARRAY once it holds no more than half of ARRAY_LIMIT values.
+ @param value is the low 16 bits of the int value being removed
+ @returns bool value of true if value was removed and false if it was not in the ChunkContainer
+ */
+bool ChunkContainer::erase_value(std::uint16_t value) {
+    //if value is not in the ChunkContainer, there is nothing to remove
+    if(!contains(value)) {
+        return false;
+    }
+    //RUN edits the run holding value in place
+    if(kind == RUN) {
+        int run = run_index(value);
+        int start = values[2 * run];
+        int end = start + values[2 * run + 1];
+        //if the run is only value, remove the run
+        if(start == end) {
+            values.erase(values.begin() + 2 * run, values.begin() + 2 * run + 2);
+        }
+        //if value starts the run, the run starts one later
+        else if(value == start) {
+            ++values[2 * run];
+            --values[2 * run + 1];
+        }
+        //if value ends the run, the run ends one earlier
+        else if(value == end) {
+            --values[2 * run + 1];
+        }
+        //else split the run around value
+        else {
+            //the second half is inserted first, so the runs are unchanged if that runs out of memory
+            std::uint16_t after[] = { static_cast<std::uint16_t>(value + 1), static_cast<std::uint16_t>(end - value - 1) };
+            values.insert(values.begin() + 2 * run + 2, after, after + 2);
+            values[2 * run + 1] = static_cast<std::uint16_t>(value - 1 - start);
+        }
+        --count_values;
+        fit_runs();
+        return true;
+    }
+    //ARRAY removes value from the sorted values
+    if(kind == ARRAY) {
+        values.erase(std::lower_bound(values.begin(), values.end(), value));
+        --count_values;
+    }
+    //BITMAP clears the bit of value, and becomes an ARRAY once it is down to half of ARRAY_LIMIT, so a count going back and forth across ARRAY_LIMIT does not convert on every insert and erase
+    else {
+        bits[value >> 6] &= ~(std::uint64_t(1) << (value & 63));
+        --count_values;
+        if(count_values <= ARRAY_LIMIT / 2) {
+            to_array();
+        }
+    }
+    return true;
+}
+
+/** Gives the number of values in the ChunkContainer
+ @returns the number of values
+ */
+int ChunkContainer::cardinality() const {
+    return count_values;
+}
+
+/** Gives the way the ChunkContainer is currently stored
+ @returns the Kind (ARRAY, BITMAP, or RUN) of the ChunkContainer
+ */
+ChunkContainer::Kind ChunkContainer::get_kind() const {
+    return kind;
+}
+
+/** Determines the smallest value in the ChunkContainer
+ @returns the smallest value, or -1 if the ChunkContainer is empty
+ */
+int ChunkContainer::first() const {
+    return next(-1);
+}
+
+/** Determines the largest value in the ChunkContainer
+ @returns the largest value, or -1 if the ChunkContainer is empty
+ */
+int ChunkContainer::last() const {
+    return previous(65536);
+}
+
+/** Determines the smallest value in the ChunkContainer that is larger than value
+ @param value is the value to start after, from -1 to 65535
+ @returns the next larger value, or -1 if there is none
+ */
+int ChunkContainer::next(int value) const {
+    //ARRAY values are sorted, so use a binary search
+    if(kind == ARRAY) {
+        std::vector<std::uint16_t>::const_iterator found = std::upper_bound(values.begin(), values.end(), value);
+        if(found == values.end()) {
+            return -1;
+        }
+        return *found;
+    }
+    //BITMAP looks for the next set bit, a whole word at a time
+    else if(kind == BITMAP) {
+        int start = value + 1;
+        if(start >= 65536) {
+            return -1;
+        }
+        int word = start >> 6;
+        std::uint64_t mask = bits[word] & (~std::uint64_t(0) << (start & 63));
+        //cycle through the words until one has a bit set
+        while(mask == 0) {
+            ++word;
+            if(word == BITMAP_WORDS) {
+                return -1;
+            }
+            mask = bits[word];
+        }
+        return (word << 6) + lowest_bit(mask);
+    }
+    //RUN steps inside the current run, or jumps to the start of the following run
+    else {
+        int run = run_index(value);
+        if(run >= 0 && value < values[2 * run] + values[2 * run + 1]) {
+            return value + 1;
+        }
+        if(2 * (run + 1) < static_cast<int>(values.size())) {
+            return values[2 * (run + 1)];
+        }
+        return -1;
+    }
+}
+
+/** Determines the largest value in the ChunkContainer that is smaller than value
+ @param value is the value to start before, from 0 to 65536
+ @returns the next smaller value, or -1 if there is none
+ */
+int ChunkContainer::previous(int value) const {
+    //ARRAY values are sorted, so use a binary search
+    if(kind == ARRAY) {
+        std::vector<std::uint16_t>::const_iterator found = std::lower_bound(values.begin(), values.end(), value);
+        if(found == values.begin()) {
+            return -1;
+        }
+        return *(found - 1);
+    }
+    //BITMAP looks for the previous set bit, a whole word at a time
+    else if(kind == BITMAP) {
+        int start = value - 1;
+        if(start < 0) {
+            return -1;
+        }
+        int word = start >> 6;
+        std::uint64_t mask = bits[word] & (~std::uint64_t(0) >> (63 - (start & 63)));
+        //cycle back through the words until one has a bit set
+        while(mask == 0) {
+            --word;
+            if(word < 0) {
+                return -1;
+            }
+            mask = bits[word];
+        }
+        return (word << 6) + highest_bit(mask);
+    }
+    //RUN returns the end of the last run starting before value, or the value just before value inside it
+    else {
+        int run = run_index(value - 1);
+        if(run < 0) {
+            return -1;
+        }
+        return std::min(values[2 * run] + values[2 * run + 1], value - 1);
+    }
+}
+
+/** Finds the last run of a RUN ChunkContainer that starts at or before value.  Runs are stored in values as pairs of the first value and the length minus one.
+ @param value is the value being looked for
+ @returns the index of the run, or -1 if every run starts after value
+ */
+int ChunkContainer::run_index(int value) const {
+    int low = 0;
+    int high = static_cast<int>(values.size() / 2);
+    //binary search for the first run that starts after value
+    while(low < high) {
+        int middle = (low + high) / 2;
+        if(values[2 * middle] <= value) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low - 1;
+}
+
+/** Changes an ARRAY ChunkContainer into a BITMAP
+ */
+void ChunkContainer::to_bitmap() {
+    bits.assign(BITMAP_WORDS, 0);
+    for(std::size_t i = 0; i < values.size(); ++i) {
+        bits[values[i] >> 6] |= std::uint64_t(1) << (values[i] & 63);
+    }
+    std::vector<std::uint16_t>().swap(values);
+    kind = BITMAP;
+}
+
+/** Changes a BITMAP ChunkContainer into an ARRAY
+ */
+void ChunkContainer::to_array() {
+    std::vector<std::uint16_t> sorted;
+    sorted.reserve(count_values);
+    //cycle through every word, clearing the lowest set bit each time it is added
+    for(int word = 0; word < BITMAP_WORDS; ++word) {
+        std::uint64_t mask = bits[word];
+        while(mask != 0) {
+            sorted.push_back(static_cast<std::uint16_t>((word << 6) + lowest_bit(mask)));
+            mask &= mask - 1;
+        }
+    }
+    values.swap(sorted);
+    std::vector<std::uint64_t>().swap(bits);
+    kind = ARRAY;
+}
+
+/** Changes a RUN ChunkContainer into an ARRAY, or into a BITMAP if it holds too many values for an ARRAY.  The new storage is filled before the runs are dropped, so the ChunkContainer is unchanged if that runs out of memory.
+ */
+void ChunkContainer::expand_runs() {
+    //small enough for an ARRAY, list every value of every run
+    if(count_values <= ARRAY_LIMIT) {
+        std::vector<std::uint16_t> listed;
+        listed.reserve(count_values);
+        for(std::size_t i = 0; i < values.size(); i += 2) {
+            for(int value = values[i]; value <= values[i] + values[i + 1]; ++value) {
+                listed.push_back(static_cast<std::uint16_t>(value));
+            }
+        }
+        values.swap(listed);
+        kind = ARRAY;
+    }
+    //else set the bits of every run
+    else {
+        bits.assign(BITMAP_WORDS, 0);
+        for(std::size_t i = 0; i < values.size(); i += 2) {
+            for(int value = values[i]; value <= values[i] + values[i + 1]; ++value) {
+                bits[value >> 6] |= std::uint64_t(1) << (value & 63);
+            }
+        }
+        std::vector<std::uint16_t>().swap(values);
+        kind = BITMAP;
+    }
+}
+
+/** Changes a RUN ChunkContainer into an ARRAY or BITMAP once its runs take more bytes than that would, which happens when inserts and erases leave many short runs
+ */
+void ChunkContainer::fit_runs() {
+    std::size_t run_bytes = values.size() * sizeof(std::uint16_t);
+    std::size_t array_bytes = count_values * sizeof(std::uint16_t);
+    std::size_t bitmap_bytes = BITMAP_WORDS * sizeof(std::uint64_t);
+    //expand_runs picks ARRAY or BITMAP by the number of values
+    if(run_bytes > std::min(array_bytes, bitmap_bytes)) {
+        expand_runs();
+    }
+}
+
+/** Stores the ChunkContainer in whichever of ARRAY, BITMAP, or RUN takes the fewest bytes.  Long stretches of consecutive values are much smaller as runs, so this is worth calling once a CompressedSet has been filled.
+ */
+void ChunkContainer::optimize() {
+    //collect the runs of consecutive values by stepping through the values in order
+    std::vector<std::uint16_t> runs;
+    int value = first();
+    while(value != -1) {
+        int end = value;
+        int following = next(end);
+        while(following == end + 1) {
+            end = following;
+            following = next(end);
+        }
+        runs.push_back(static_cast<std::uint16_t>(value));
+        runs.push_back(static_cast<std::uint16_t>(end - value));
+        value = following;
+    }
+    std::size_t run_bytes = runs.size() * sizeof(std::uint16_t);
+    std::size_t array_bytes = count_values * sizeof(std::uint16_t);
+    std::size_t bitmap_bytes = BITMAP_WORDS * sizeof(std::uint64_t);
+    //if runs are the smallest, store them
+    if(run_bytes < std::min(array_bytes, bitmap_bytes)) {
+        values.swap(runs);
+        std::vector<std::uint64_t>().swap(bits);
+        kind = RUN;
+    }
+    //else ARRAY or BITMAP is picked by the number of values
+    else if(kind == RUN) {
+        expand_runs();
+    }
+    //a BITMAP that erase kept above half of ARRAY_LIMIT is smaller as an ARRAY
+    else if(kind == BITMAP && count_values <= ARRAY_LIMIT) {
+        to_array();
+    }
+    values.shrink_to_fit();
+}
+
+/** Creates a ChunkContainer holding the values that are in both this ChunkContainer and other.  Two BITMAPs are combined with and_count, which ANDs and counts the words in one pass.
+ @param other is a const reference to the ChunkContainer being intersected with
+ @returns a ChunkContainer holding the common values
+ */
+ChunkContainer ChunkContainer::intersect(const ChunkContainer& other) const {
+    //runs are expanded on a copy first so only ARRAY and BITMAP need to be handled
+    if(kind == RUN) {
+        ChunkContainer expanded(*this);
+        expanded.expand_runs();
+        return expanded.intersect(other);
+    }
+    if(other.kind == RUN) {
+        ChunkContainer expanded(other);
+        expanded.expand_runs();
+        return intersect(expanded);
+    }
+    ChunkContainer result;
+    //both BITMAP, AND the words together and count the bits
+    if(kind == BITMAP && other.kind == BITMAP) {
+        result.bits.resize(BITMAP_WORDS);
+        result.kind = BITMAP;
+        result.count_values = and_count(bits.data(), other.bits.data(), result.bits.data());
+        if(result.count_values <= ARRAY_LIMIT) {
+            result.to_array();
+        }
+    }
+    //both ARRAY, merge the sorted values
+    else if(kind == ARRAY && other.kind == ARRAY) {
+        std::set_intersection(values.begin(), values.end(), other.values.begin(), other.values.end(), std::back_inserter(result.values));
+        result.count_values = static_cast<int>(result.values.size());
+    }
+    //one ARRAY and one BITMAP, keep the ARRAY values whose bits are set
+    else {
+        const ChunkContainer& array = (kind == ARRAY) ? *this : other;
+        const ChunkContainer& bitmap = (kind == ARRAY) ? other : *this;
+        for(std::size_t i = 0; i < array.values.size(); ++i) {
+            if(bitmap.contains(array.values[i])) {
+                result.values.push_back(array.values[i]);
+            }
+        }
+        result.count_values = static_cast<int>(result.values.size());
+    }
+    return result;
+}
+
+/** Counts the values that are in both this ChunkContainer and other without building a ChunkContainer for them.  Two BITMAPs are counted with and_count, two RUN lists by adding up how much the runs overlap, and every other pair by looking up the values of the smaller side in the other.
+ @param other is a const reference to the ChunkContainer being intersected with
+ @returns the number of common values
+ */
+int ChunkContainer::intersect_count(const ChunkContainer& other) const {
+    //both BITMAP, AND and count the words without storing them
+    if(kind == BITMAP && other.kind == BITMAP) {
+        return and_count(bits.data(), other.bits.data(), nullptr);
+    }
+    //both RUN, walk the two lists of runs together and add the overlaps
+    if(kind == RUN && other.kind == RUN) {
+        int total = 0;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while(i < values.size() && j < other.values.size()) {
+            int end = values[i] + values[i + 1];
+            int other_end = other.values[j] + other.values[j + 1];
+            int overlap = std::min(end, other_end) - std::max<int>(values[i], other.values[j]) + 1;
+            if(overlap > 0) {
+                total += overlap;
+            }
+            //move past whichever run ends first
+            if(end < other_end) {
+                i += 2;
+            }
+            else {
+                j += 2;
+            }
+        }
+        return total;
+    }
+    //a RUN list and a BITMAP, count the bits inside each run
+    if(kind == RUN || other.kind == RUN) {
+        const ChunkContainer& runs = (kind == RUN) ? *this : other;
+        const ChunkContainer& rest = (kind == RUN) ? other : *this;
+        if(rest.kind == BITMAP) {
+            int total = 0;
+            for(std::size_t i = 0; i < runs.values.size(); i += 2) {
+                total += rest.count_range(runs.values[i], runs.values[i] + runs.values[i + 1]);
+            }
+            return total;
+        }
+    }
+    //both ARRAY, merge the sorted values
+    if(kind == ARRAY && other.kind == ARRAY) {
+        int total = 0;
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while(i < values.size() && j < other.values.size()) {
+            if(values[i] < other.values[j]) {
+                ++i;
+            }
+            else if(other.values[j] < values[i]) {
+                ++j;
+            }
+            else {
+                ++total;
+                ++i;
+                ++j;
+            }
+        }
+        return total;
+    }
+    //one ARRAY, look up each of its values in the other ChunkContainer
+    const ChunkContainer& array = (kind == ARRAY) ? *this : other;
+    const ChunkContainer& rest = (kind == ARRAY) ? other : *this;
+    int total = 0;
+    for(std::size_t i = 0; i < array.values.size(); ++i) {
+        if(rest.contains(array.values[i])) {
+            ++total;
+        }
+    }
+    return total;
+}
+
+/** Counts the values of a BITMAP ChunkContainer from start to end, masking off the bits outside the range in the first and last words
+ @param start is the smallest value counted
+ @param end is the largest value counted, not smaller than start
+ @returns the number of values from start to end
+ */
+int ChunkContainer::count_range(int start, int end) const {
+    int first_word = start >> 6;
+    int last_word = end >> 6;
+    std::uint64_t first_mask = ~std::uint64_t(0) << (start & 63);
+    std::uint64_t last_mask = ~std::uint64_t(0) >> (63 - (end & 63));
+    //the whole range is in one word
+    if(first_word == last_word) {
+        return popcount(bits[first_word] & first_mask & last_mask);
+    }
+    int total = popcount(bits[first_word] & first_mask) + popcount(bits[last_word] & last_mask);
+    for(int word = first_word + 1; word < last_word; ++word) {
+        total += popcount(bits[word]);
+    }
+    return total;
+}
+
+/** Determines how many bytes the ChunkContainer uses, including its heap storage and what the heap adds to each allocation
+ @returns the number of bytes used
+ */
+std::size_t ChunkContainer::memory_usage() const {
+    std::size_t total = heap_bytes(sizeof(ChunkContainer));
+    //an empty vector has no heap block
+    if(values.capacity() > 0) {
+        total += heap_bytes(values.capacity() * sizeof(std::uint16_t));
+    }
+    if(bits.capacity() > 0) {
+        total += heap_bytes(bits.capacity() * sizeof(std::uint64_t));
+    }
+    return total;
+}
+
+/** Estimates how many bytes the heap really takes for one allocation, following glibc malloc on 64 bit systems: an 8 byte header is added, the block is rounded up to a multiple of 16, and no block is smaller than 32 bytes.  Used so that memory_usage of a CompressedSet and the size of a BinarySearchTree (one allocation per TreeNode) are counted the same way.
+ @param requested is the number of bytes asked for
+ @returns the number of bytes the allocation takes
+ */
+std::size_t ChunkContainer::heap_bytes(std::size_t requested) {
+    std::size_t block = (requested + 8 + 15) / 16 * 16;
+    return std::max<std::size_t>(block, 32);
+}
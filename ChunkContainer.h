@@ -0,0 +1,57 @@
+/** @file ChunkContainer.h
+ @brief This file contains the declarations for the ChunkContainer class
+ */
+
+#ifndef CHUNKCONTAINER_H
+#define CHUNKCONTAINER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** @class ChunkContainer
+ @brief The ChunkContainer class holds the low 16 bits of every int value in the CompressedSet that shares the same high 16 bits.  A ChunkContainer is stored in one of three ways: a sorted ARRAY of values (2 bytes per value, used for up to 4096 values), a BITMAP with one bit for each of the 65536 possible values (8 KB no matter how many values), or a list of RUNs of consecutive values (4 bytes per run).  Insert and erase move between ARRAY and BITMAP as the number of values changes (a BITMAP only goes back to an ARRAY at 2048 values, so a count hovering around 4096 does not convert back and forth) and edit RUNs in place, only leaving RUN once the runs grow larger than an ARRAY or BITMAP would be, while optimize picks whichever of the three is smallest.
+ */
+class ChunkContainer {
+public:
+    enum Kind { ARRAY, BITMAP, RUN };
+    
+    ChunkContainer();
+    bool insert_value(std::uint16_t value);
+    bool erase_value(std::uint16_t value);
+    bool contains(std::uint16_t value) const;
+    int cardinality() const;
+    Kind get_kind() const;
+    int first() const;
+    int last() const;
+    int next(int value) const;
+    int previous(int value) const;
+    void optimize();
+    ChunkContainer intersect(const ChunkContainer& other) const;
+    int intersect_count(const ChunkContainer& other) const;
+    std::size_t memory_usage() const;
+    
+    static std::size_t heap_bytes(std::size_t requested);
+    
+    /** Destructor for the ChunkContainer class, empty.  It is not virtual since nothing derives from ChunkContainer, which keeps a vtable pointer out of every chunk.
+     */
+    ~ChunkContainer() {};
+private:
+    static int popcount(std::uint64_t word);
+    static int and_count(const std::uint64_t* left, const std::uint64_t* right, std::uint64_t* result);
+    static int lowest_bit(std::uint64_t word);
+    static int highest_bit(std::uint64_t word);
+    int run_index(int value) const;
+    int count_range(int start, int end) const;
+    void to_bitmap();
+    void to_array();
+    void expand_runs();
+    void fit_runs();
+    
+    Kind kind;
+    int count_values;
+    std::vector<std::uint16_t> values;
+    std::vector<std::uint64_t> bits;
+};
+
+#endif
@@ -0,0 +1,113 @@
+/** @file CompressedIterator.cpp
+ @brief This file contains the definitions for the CompressedIterator class
+ */
+
+#include <utility>
+#include "CompressedIterator.h"
+#include "CompressedSet.h"
+
+/** Default constructor for CompressedIterator class which sets chunk to 0, low to -1, and container to nullptr
+ */
+CompressedIterator::CompressedIterator() : chunk(0), low(-1), container(nullptr) {
+    
+}
+
+/** Copy constructor that makes a CompressedIterator pointing to the same int value of the same CompressedSet as copy
+ @param copy is a const reference of the CompressedIterator object that is being copied
+ */
+CompressedIterator::CompressedIterator(const CompressedIterator& copy) : chunk(copy.chunk), low(copy.low), container(copy.container) {
+    
+}
+
+/** Swap function swaps the position and container between the called CompressedIterator and other
+ @param other is the CompressedIterator object whose chunk, low, and container are being swapped
+ */
+void CompressedIterator::swap(CompressedIterator& other) {
+    std::swap(chunk, other.chunk);
+    std::swap(low, other.low);
+    std::swap(container, other.container);
+}
+
+/** Overload operator= to swap copy of the CompressedIterator input
+ @param copy is a copy of the CompressedIterator object being assigned
+ @returns a reference to the CompressedIterator object that was assigned the values of copy
+ */
+CompressedIterator& CompressedIterator::operator=(CompressedIterator copy) {
+    copy.swap(*this);
+    return *this;
+}
+
+/** Overload prefix operator++ which moves CompressedIterator to the next largest int value, going on to the smallest value of the next chunk when the current chunk is done
+ @returns a reference to the CompressedIterator that has the next largest int value
+ */
+CompressedIterator& CompressedIterator::operator++() {
+    low = container->chunks[chunk]->next(low);
+    //if the chunk has no larger value, move to the first value of the next chunk
+    if(low == -1) {
+        ++chunk;
+        if(chunk < container->chunks.size()) {
+            low = container->chunks[chunk]->first();
+        }
+    }
+    return *this;
+}
+
+/** Overload postfix operator++ which increments the CompressedIterator object and returns an unincremented copy
+ @returns an unincremented copy of the CompressedIterator object
+ */
+CompressedIterator CompressedIterator::operator++(int) {
+    CompressedIterator copy = *this;
+    ++(*this);
+    return copy;
+}
+
+/** Overload prefix operator-- which moves CompressedIterator to the next smallest int value, going back to the largest value of the previous chunk when needed
+ @returns a reference to the CompressedIterator that has the next smallest int value
+ */
+CompressedIterator& CompressedIterator::operator--() {
+    //if currently one past the last value there is no value in this chunk to step back from
+    if(chunk < container->chunks.size()) {
+        low = container->chunks[chunk]->previous(low);
+    }
+    else {
+        low = -1;
+    }
+    //if the chunk has no smaller value, move to the last value of the previous chunk
+    if(low == -1 && chunk > 0) {
+        --chunk;
+        low = container->chunks[chunk]->last();
+    }
+    return *this;
+}
+
+/** Overload postfix operator-- which decrements the CompressedIterator object and returns an undecremented copy
+ @returns an undecremented copy of the CompressedIterator object
+ */
+CompressedIterator CompressedIterator::operator--(int) {
+    CompressedIterator copy = *this;
+    --(*this);
+    return copy;
+}
+
+/** Overload comparison operator== to compare if two CompressedIterators point to the same int value
+ @param rhs is a const reference of the CompressedIterator on the right of the == operator that is being compared
+ @returns a bool value determining if the two CompressedIterators are equal
+ */
+bool CompressedIterator::operator==(const CompressedIterator& rhs) {
+    return (chunk == rhs.chunk) && (low == rhs.low);
+}
+
+/** Overload comparison operator!= to compare if two CompressedIterators point to different int values
+ @param rhs is the const reference of the CompressedIterator on the right of the != operator that is being compared
+ @returns a bool value determining if the two CompressedIterators are unequal
+ */
+bool CompressedIterator::operator!=(const CompressedIterator& rhs) {
+    return !(*this == rhs);
+}
+
+/** Overload operator* to dereference CompressedIterator
+ @returns the int value the CompressedIterator points to
+ */
+int CompressedIterator::operator*() {
+    return CompressedSet::to_data(container->highs[chunk], low);
+}
@@ -0,0 +1,40 @@
+/** @file CompressedIterator.h
+ @brief This file contains the declarations for the CompressedIterator class.
+ */
+
+#ifndef COMPRESSEDITERATOR_H
+#define COMPRESSEDITERATOR_H
+
+#include <cstddef>
+
+class CompressedSet;
+
+/** @class CompressedIterator
+ @brief The CompressedIterator class is a bidirectional iterator used in the CompressedSet class.  Each CompressedIterator object contains the index of the chunk it is in, the low 16 bits of the value it points to, and a pointer to its CompressedSet.  The ++/-- (both prefix and postfix), ==, !=, and * operators have been overloaded.  Since values are stored as bits and not in TreeNodes, * returns the int value instead of a reference.
+ */
+class CompressedIterator {
+public:
+    CompressedIterator();
+    CompressedIterator(const CompressedIterator& copy);
+    void swap(CompressedIterator& other);
+    CompressedIterator& operator=(CompressedIterator copy);
+    CompressedIterator& operator++();
+    CompressedIterator operator++(int);
+    CompressedIterator& operator--();
+    CompressedIterator operator--(int);
+    bool operator==(const CompressedIterator& rhs);
+    bool operator!=(const CompressedIterator& rhs);
+    int operator*();
+    
+    /** Virtual destructor for the CompressedIterator class, empty
+     */
+    virtual ~CompressedIterator() {};
+private:
+    std::size_t chunk;
+    int low;
+    CompressedSet* container;
+    friend class CompressedSet;
+};
+
+
+#endif
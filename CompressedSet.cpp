@@ -0,0 +1,302 @@
+/** @file CompressedSet.cpp
+ @brief This file contains the definitions for the CompressedSet class
+ */
+
+#include <algorithm>
+#include "CompressedSet.h"
+
+/** Default constructor that creates an empty CompressedSet with no chunks
+ */
+CompressedSet::CompressedSet() {
+    
+}
+
+/** Copy constructor that makes a deep copy of the CompressedSet object by allocating a copy of each of its ChunkContainers.  If memory runs out, std::bad_alloc is thrown and nothing is leaked.
+ @param copy is a const reference of the CompressedSet object that is being copied
+ */
+CompressedSet::CompressedSet(const CompressedSet& copy) : highs(copy.highs) {
+    chunks.reserve(copy.chunks.size());
+    //if a ChunkContainer cannot be allocated, delete the ones already copied and pass the std::bad_alloc on
+    try {
+        for(std::size_t i = 0; i < copy.chunks.size(); ++i) {
+            chunks.push_back(new ChunkContainer(*copy.chunks[i]));
+        }
+    }
+    catch(...) {
+        for(std::size_t i = 0; i < chunks.size(); ++i) {
+            delete chunks[i];
+        }
+        throw;
+    }
+}
+
+/** Swap function exchanges the chunks between the called CompressedSet object and other.
+ @param other is the CompressedSet object whose chunks are being swapped
+ */
+void CompressedSet::swap(CompressedSet& other) {
+    highs.swap(other.highs);
+    chunks.swap(other.chunks);
+}
+
+/** Overload operator= to use copy and swap idiom to make a deep copy of the CompressedSet copy.
+ @param copy is a copy of the CompressedSet object being assigned
+ @returns a reference to the CompressedSet object that was assigned (through swap) the values of copy
+ */
+CompressedSet& CompressedSet::operator=(CompressedSet copy) {
+    copy.swap(*this);
+    return *this;
+}
+
+/** Maps an int value onto an unsigned key by flipping the sign bit, so that negative values come before positive ones when the keys are compared
+ @param data is the int value being mapped
+ @returns the unsigned 32 bit key of data
+ */
+std::uint32_t CompressedSet::to_key(int data) {
+    return static_cast<std::uint32_t>(data) ^ 0x80000000u;
+}
+
+/** Rebuilds the int value from the high 16 bits of its chunk and its low 16 bits, undoing to_key
+ @param high is the high 16 bits of the key
+ @param low is the low 16 bits of the key
+ @returns the int value of the key
+ */
+int CompressedSet::to_data(std::uint16_t high, int low) {
+    return static_cast<int>(((static_cast<std::uint32_t>(high) << 16) | static_cast<std::uint32_t>(low)) ^ 0x80000000u);
+}
+
+/** Finds the chunk holding the values with the given high 16 bits using a binary search
+ @param high is the high 16 bits being looked for
+ @returns the index of the chunk, or -1 if there is no such chunk
+ */
+int CompressedSet::find_chunk(std::uint16_t high) const {
+    std::vector<std::uint16_t>::const_iterator found = std::lower_bound(highs.begin(), highs.end(), high);
+    if(found == highs.end() || *found != high) {
+        return -1;
+    }
+    return static_cast<int>(found - highs.begin());
+}
+
+/** Print function prints out all int values of the CompressedSet from smallest to largest
+ */
+void CompressedSet::print() const {
+    for(std::size_t i = 0; i < chunks.size(); ++i) {
+        //cycle through the values of each chunk in order
+        for(int low = chunks[i]->first(); low != -1; low = chunks[i]->next(low)) {
+            std::cout << to_data(highs[i], low) << std::endl;
+        }
+    }
+}
+
+/** Adds an int value to the CompressedSet, creating its chunk if it does not exist yet.  If memory runs out, std::bad_alloc is thrown and a new chunk is not left behind.
+ @param data is the int value being added
+ */
+void CompressedSet::insert(int data) {
+    std::uint32_t key = to_key(data);
+    std::uint16_t high = static_cast<std::uint16_t>(key >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(key & 0xFFFF);
+    std::size_t index = std::lower_bound(highs.begin(), highs.end(), high) - highs.begin();
+    //if the chunk for the high 16 bits exists, add to it
+    if(index < highs.size() && highs[index] == high) {
+        chunks[index]->insert_value(low);
+        return;
+    }
+    //else fill a new chunk first and then insert it in sorted position, so that no empty chunk is ever stored
+    ChunkContainer* new_chunk = new ChunkContainer;
+    //if the value or the chunk cannot be added, delete the chunk and pass the std::bad_alloc on
+    try {
+        new_chunk->insert_value(low);
+        chunks.insert(chunks.begin() + index, new_chunk);
+    }
+    catch(...) {
+        delete new_chunk;
+        throw;
+    }
+    //if highs cannot grow, take the chunk back out so both lists still match
+    try {
+        highs.insert(highs.begin() + index, high);
+    }
+    catch(...) {
+        chunks.erase(chunks.begin() + index);
+        delete new_chunk;
+        throw;
+    }
+}
+
+/** Removes an int value from the CompressedSet, and removes its chunk once the chunk is empty
+ @param data is the int value being removed
+ */
+void CompressedSet::erase(int data) {
+    std::uint32_t key = to_key(data);
+    int index = find_chunk(static_cast<std::uint16_t>(key >> 16));
+    //if there is no chunk for the high 16 bits, data is not in the CompressedSet
+    if(index == -1) {
+        return;
+    }
+    chunks[index]->erase_value(static_cast<std::uint16_t>(key & 0xFFFF));
+    //an empty chunk is removed so that iteration never lands in it
+    if(chunks[index]->cardinality() == 0) {
+        delete chunks[index];
+        highs.erase(highs.begin() + index);
+        chunks.erase(chunks.begin() + index);
+    }
+}
+
+/** Counts the number of times the data value is in the CompressedSet
+ @param data is the int value that is being looked for
+ @returns an int 0 or 1 whether or not the input data has been found
+ */
+int CompressedSet::count(int data) const {
+    std::uint32_t key = to_key(data);
+    int index = find_chunk(static_cast<std::uint16_t>(key >> 16));
+    //if there is no chunk for the high 16 bits, data is not in the CompressedSet
+    if(index == -1) {
+        return 0;
+    }
+    return chunks[index]->contains(static_cast<std::uint16_t>(key & 0xFFFF)) ? 1 : 0;
+}
+
+/** Determines the smallest int value contained within the CompressedSet
+ @returns the smallest int value
+ */
+int CompressedSet::smallest() {
+    return *begin();
+}
+
+/** Determines the largest int value contained within the CompressedSet
+ @returns the largest int value
+ */
+int CompressedSet::largest() {
+    CompressedIterator largest_value = end();
+    //one step back from one past the largest value is the largest value
+    --largest_value;
+    return *largest_value;
+}
+
+/** Creates a CompressedIterator object that points to the first (smallest) int value in the CompressedSet
+ @returns a CompressedIterator object that points to the first int value in the CompressedSet
+ */
+CompressedIterator CompressedSet::begin() {
+    CompressedIterator begin;
+    begin.container = this;
+    begin.chunk = 0;
+    //an empty CompressedSet starts at end
+    if(chunks.empty()) {
+        begin.low = -1;
+    }
+    else {
+        begin.low = chunks[0]->first();
+    }
+    return begin;
+}
+
+/** Creates a CompressedIterator object that points one past the largest int value in the CompressedSet
+ @returns a CompressedIterator object that points one past the last int value in the CompressedSet
+ */
+CompressedIterator CompressedSet::end() {
+    CompressedIterator end;
+    end.container = this;
+    end.chunk = chunks.size();
+    end.low = -1;
+    return end;
+}
+
+/** Gives the number of int values in the CompressedSet
+ @returns the number of int values
+ */
+std::size_t CompressedSet::size() const {
+    std::size_t total = 0;
+    for(std::size_t i = 0; i < chunks.size(); ++i) {
+        total += chunks[i]->cardinality();
+    }
+    return total;
+}
+
+/** Determines how many bytes the CompressedSet uses, including the ChunkContainers, their heap storage, and what the heap adds to each allocation (see ChunkContainer::heap_bytes)
+ @returns the number of bytes used
+ */
+std::size_t CompressedSet::memory_usage() const {
+    std::size_t total = sizeof(CompressedSet);
+    //an empty vector has no heap block
+    if(highs.capacity() > 0) {
+        total += ChunkContainer::heap_bytes(highs.capacity() * sizeof(std::uint16_t));
+    }
+    if(chunks.capacity() > 0) {
+        total += ChunkContainer::heap_bytes(chunks.capacity() * sizeof(ChunkContainer*));
+    }
+    for(std::size_t i = 0; i < chunks.size(); ++i) {
+        total += chunks[i]->memory_usage();
+    }
+    return total;
+}
+
+/** Stores every chunk in whichever of ARRAY, BITMAP, or RUN takes the fewest bytes.  Insert and erase never create runs (they only keep existing runs up to date), so call this after filling the CompressedSet to turn long stretches of consecutive values into runs.
+ */
+void CompressedSet::optimize() {
+    for(std::size_t i = 0; i < chunks.size(); ++i) {
+        chunks[i]->optimize();
+    }
+    highs.shrink_to_fit();
+    chunks.shrink_to_fit();
+}
+
+/** Creates a CompressedSet holding the int values that are in both this CompressedSet and other.  Only chunks whose high 16 bits appear in both are intersected, walking the two sorted lists of chunks together.  If memory runs out, std::bad_alloc is thrown.
+ @param other is a const reference to the CompressedSet being intersected with
+ @returns a CompressedSet holding the common int values
+ */
+CompressedSet CompressedSet::intersection(const CompressedSet& other) const {
+    CompressedSet result;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    //cycle through both lists of chunks until one runs out
+    while(i < highs.size() && j < other.highs.size()) {
+        //if this chunk comes first, it has no match in other
+        if(highs[i] < other.highs[j]) {
+            ++i;
+        }
+        //if the chunk of other comes first, it has no match in this CompressedSet
+        else if(other.highs[j] < highs[i]) {
+            ++j;
+        }
+        //else the high 16 bits match, intersect the chunks and keep the result if it is not empty
+        else {
+            ChunkContainer common = chunks[i]->intersect(*other.chunks[j]);
+            //the slot is added before allocating so the ChunkContainer is owned by result (and deleted if anything throws) as soon as it exists
+            if(common.cardinality() > 0) {
+                result.highs.push_back(highs[i]);
+                result.chunks.push_back(nullptr);
+                result.chunks.back() = new ChunkContainer(common);
+            }
+            ++i;
+            ++j;
+        }
+    }
+    return result;
+}
+
+/** Counts the int values that are in both this CompressedSet and other without creating a CompressedSet for them.  Chunks whose high 16 bits appear in both are counted with ChunkContainer::intersect_count, so no ChunkContainer is allocated.
+ @param other is a const reference to the CompressedSet being intersected with
+ @returns the number of common int values
+ */
+std::size_t CompressedSet::intersection_size(const CompressedSet& other) const {
+    std::size_t total = 0;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    //cycle through both lists of chunks until one runs out
+    while(i < highs.size() && j < other.highs.size()) {
+        //if this chunk comes first, it has no match in other
+        if(highs[i] < other.highs[j]) {
+            ++i;
+        }
+        //if the chunk of other comes first, it has no match in this CompressedSet
+        else if(other.highs[j] < highs[i]) {
+            ++j;
+        }
+        //else the high 16 bits match, count the common values of the chunks
+        else {
+            total += chunks[i]->intersect_count(*other.chunks[j]);
+            ++i;
+            ++j;
+        }
+    }
+    return total;
+}
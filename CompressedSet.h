@@ -0,0 +1,60 @@
+/** @file CompressedSet.h
+ @brief This file contains the declarations for the CompressedSet class, a compact alternative to the BinarySearchTree for sets of int values.
+ */
+
+#ifndef COMPRESSEDSET_H
+#define COMPRESSEDSET_H
+
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ChunkContainer.h"
+#include "CompressedIterator.h"
+
+/** @class CompressedSet
+ @brief The CompressedSet class stores a set of int values with the same functions as the BinarySearchTree (insert, erase, count, print, smallest, largest, begin, and end), but without a TreeNode for each value.  The int values are split by their high 16 bits into chunks, and each chunk keeps its low 16 bits in a heap allocated ChunkContainer (only pointers are shifted when a chunk is added or removed) that is an ARRAY, BITMAP, or RUN list, whichever suits how the values are spread out.  Dense sets take close to one bit per value instead of a TreeNode of around 40 bytes.  The chunks are kept sorted by their high 16 bits, so a CompressedIterator visits the values from smallest to largest.  The CompressedSet class has friendship with the CompressedIterator class.
+ */
+class CompressedSet {
+public:
+    //Constructors
+    CompressedSet();
+    CompressedSet(const CompressedSet& copy);
+    
+    //Other functions
+    void swap(CompressedSet& other);
+    CompressedSet& operator=(CompressedSet copy);
+    
+    void insert(int data);
+    void erase(int data);
+    int count(int data) const;
+    void print() const;
+    int smallest();
+    int largest();
+    CompressedIterator begin();
+    CompressedIterator end();
+    
+    std::size_t size() const;
+    std::size_t memory_usage() const;
+    void optimize();
+    CompressedSet intersection(const CompressedSet& other) const;
+    std::size_t intersection_size(const CompressedSet& other) const;
+    
+    /** Virtual destructor for the CompressedSet class, deletes every ChunkContainer
+     */
+    virtual ~CompressedSet() {
+        for(std::size_t i = 0; i < chunks.size(); ++i) {
+            delete chunks[i];
+        }
+    }
+private:
+    static std::uint32_t to_key(int data);
+    static int to_data(std::uint16_t high, int low);
+    int find_chunk(std::uint16_t high) const;
+    
+    std::vector<std::uint16_t> highs;
+    std::vector<ChunkContainer*> chunks;
+    friend class CompressedIterator;
+};
+
+#endif
@@ -29,29 +29,32 @@ TreeIterator& TreeIterator::operator=(TreeIterator copy) {
     return *this;
 }
 
-/** Overload prefix operator++ which moves TreeIterator to the TreeIterator with the next largest int data
+/** Overload prefix operator++ which moves TreeIterator to the TreeIterator with the next largest int data, skipping TreeNodes that were erased lazily
  @returns a reference to the TreeIterator that has the next largest int data
 */
 TreeIterator& TreeIterator::operator++() {
-    //if there is a TreeNode to the right, go right
-    if(node_pointer->right != nullptr) {
-        node_pointer = node_pointer->right;
-        //cycle node_pointer to the very left TreeNode
-        while(node_pointer->left != nullptr) {
-            node_pointer = node_pointer->left;
+    //keep stepping while the TreeNode reached is waiting to be compacted
+    do {
+        //if there is a TreeNode to the right, go right
+        if(node_pointer->right != nullptr) {
+            node_pointer = node_pointer->right;
+            //cycle node_pointer to the very left TreeNode
+            while(node_pointer->left != nullptr) {
+                node_pointer = node_pointer->left;
+            }
         }
-    }
-    //if there is a TreeNode to the left, go back
-    else {
-        TreeNode* store = nullptr;
-        store = node_pointer->node_parent;
-        //cycle until node_parent is nullptr or reach left child
-        while(store != nullptr && node_pointer == store->right) {
+        //if there is a TreeNode to the left, go back
+        else {
+            TreeNode* store = nullptr;
+            store = node_pointer->node_parent;
+            //cycle until node_parent is nullptr or reach left child
+            while(store != nullptr && node_pointer == store->right) {
+                node_pointer = store;
+                store = store->node_parent;
+            }
             node_pointer = store;
-            store = store->node_parent;
         }
-        node_pointer = store;
-    }
+    } while(node_pointer != nullptr && node_pointer->erased);
     return *this;
 }
 
@@ -64,38 +67,40 @@ TreeIterator TreeIterator::operator++(int unused) {
     return copy;
 }
 
-/** Overload prefix operator-- which decrements the TreeIterator object to a TreeIterator object with the next smallest int data
+/** Overload prefix operator-- which decrements the TreeIterator object to a TreeIterator object with the next smallest int data, skipping TreeNodes that were erased lazily
  @returns a reference to the TreeIterator that has the next smallest int data
 */
 TreeIterator& TreeIterator::operator--() {
-    //if node_pointer is nullptr, then currently at one past the last TreeIterator
-    if(node_pointer == nullptr) {
-        node_pointer = container->root;
-        //sets node_pointer to largest value
-        while(node_pointer != nullptr) {
-            node_pointer = node_pointer->right;
+    //keep stepping while the TreeNode reached is waiting to be compacted
+    do {
+        //if node_pointer is nullptr, then currently at one past the last TreeIterator
+        if(node_pointer == nullptr) {
+            node_pointer = container->root;
+            //sets node_pointer to largest value
+            while(node_pointer != nullptr && node_pointer->right != nullptr) {
+                node_pointer = node_pointer->right;
+            }
         }
-        return *this;
-    }
-    //if there is a TreeNode to the left, go left
-    if(node_pointer->left != nullptr) {
-        node_pointer = node_pointer->left;
-        //cycle node_pointer to the very right TreeNode of the left subtree
-        while(node_pointer->right != nullptr) {
-            node_pointer = node_pointer->right;
+        //if there is a TreeNode to the left, go left
+        else if(node_pointer->left != nullptr) {
+            node_pointer = node_pointer->left;
+            //cycle node_pointer to the very right TreeNode of the left subtree
+            while(node_pointer->right != nullptr) {
+                node_pointer = node_pointer->right;
+            }
         }
-    }
-    //if there is a TreeNode to the right, go back
-    else {
-        TreeNode* store = nullptr;
-        store = node_pointer->node_parent;
-        //cycle until node_parent is nullptr or reach right child
-        while(store != nullptr && node_pointer == store->left) {
+        //if there is a TreeNode to the right, go back
+        else {
+            TreeNode* store = nullptr;
+            store = node_pointer->node_parent;
+            //cycle until node_parent is nullptr or reach right child
+            while(store != nullptr && node_pointer == store->left) {
+                node_pointer = store;
+                store = store->node_parent;
+            }
             node_pointer = store;
-            store = store->node_parent;
         }
-        node_pointer = store;
-    }
+    } while(node_pointer != nullptr && node_pointer->erased);
     return *this;
 }
 
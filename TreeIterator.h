@@ -7,6 +7,8 @@
 
 #include "TreeNode.h"
 
+class BinarySearchTree;
+
 /** @class TreeIterator
  @brief The TreeIterator class is designed to be a bidirectional iterator used in the BinarySearchTree class.  Each TreeIterator object contains a TreeNode pointer and a BinarySearchTree.  The ++/-- (both prefix and postfix), ==, !=, and *(returns a reference) operators have been overloaded.
  */
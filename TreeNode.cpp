@@ -38,7 +38,7 @@ void TreeNode::insert_node(TreeNode* new_node) {
     }
 }
 
-/** Uses the properties of the BinarySearchTree to determine recursively whether the TreeNode of a certain int value exists within the BinarySearchTree
+/** Uses the properties of the BinarySearchTree to determine recursively whether the TreeNode of a certain int value exists within the BinarySearchTree.  A TreeNode that has been erased lazily does not count.
  @returns bool value of 0 if TreeNode of input value is not in the BinarySearchTree and 1 if the value is in the BinarySearchTree
 */
 bool TreeNode::find(int value) const {
@@ -64,20 +64,23 @@ bool TreeNode::find(int value) const {
             return right->find(value);
         }
     }
-    //if data==value, return true
+    //if data==value, return true unless the TreeNode is waiting to be compacted
     else {
-        return true;
+        return !erased;
     }
 }
 
-/** Recursively goes through BinarySearchTree and prints out all int values of the TreeNodes
+/** Recursively goes through BinarySearchTree and prints out all int values of the TreeNodes that have not been erased
  */
 void TreeNode::print_nodes() const {
     //if left is not nullptr, go left and print
     if(left != nullptr) {
         left->print_nodes();
     }
-    std::cout << data << std::endl;
+    //TreeNodes erased lazily are skipped
+    if(!erased) {
+        std::cout << data << std::endl;
+    }
     //if right is not nullptr, go right and print
     if(right != nullptr) {
         right->print_nodes();
@@ -8,7 +8,7 @@
 #include <iostream>
 
 /** @class TreeNode
- @brief The TreeNode class creates the nodes that will be connected to form the BinarySearchTree.  Each node contains an int data value and pointers to the left child, right child, and parent nodes.  The insert_node, find, and print_nodes all use recursion to perform there neccessary operations.
+ @brief The TreeNode class creates the nodes that will be connected to form the BinarySearchTree.  Each node contains an int data value and pointers to the left child, right child, and parent nodes, along with an erased flag that marks TreeNodes erased lazily by the BinarySearchTree and still waiting to be compacted.  The insert_node, find, and print_nodes all use recursion to perform there neccessary operations.
  */
 class TreeNode {
 public:
@@ -21,6 +21,7 @@ public:
     virtual ~TreeNode() {};
 private:
     int data;
+    bool erased;
     TreeNode* left;
     TreeNode* right;
     TreeNode* node_parent;
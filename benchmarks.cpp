@@ -0,0 +1,291 @@
+/** @file benchmarks.cpp
+ @brief This file contains a benchmark driver for the BinarySearchTree and the CompressedSet.  It has its own main function, so it is built on its own instead of together with hw6.cpp:
+
+    g++ -std=c++11 -O2 benchmarks.cpp BinarySearchTree.cpp TreeNode.cpp TreeIterator.cpp CompressedSet.cpp ChunkContainer.cpp CompressedIterator.cpp -o benchmarks
+
+ No -mavx2 or -mpopcnt flag is needed, ChunkContainer picks its AVX2 or POPCNT code for BITMAP intersections when the program runs.
+
+ Every timing is the best of several repetitions, since single runs on a busy machine vary by more than the differences being measured.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <climits>
+#include "BinarySearchTree.h"
+#include "CompressedSet.h"
+
+//number of times each timing is repeated, the fastest is reported
+const int REPEATS = 5;
+
+/** Runs a function several times and times it
+ @param run is the function being timed, it is called REPEATS times
+ @returns the fastest time in seconds
+ */
+template <typename Function>
+double best_seconds(Function run) {
+    double best = 0;
+    for(int i = 0; i < REPEATS; ++i) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        run();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        //keep the fastest repetition
+        if(i == 0 || seconds < best) {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/** Creates a list of lookups drawn from keys, either uniformly or following a Zipf distribution where the i-th key is picked with probability proportional to 1 / i^1.1
+ @param keys is a const reference to the int values being looked up
+ @param lookups is the number of lookups created
+ @param zipf is true for a Zipf distribution and false for a uniform one
+ @param generator is a reference to the random number generator used
+ @returns the list of lookups
+ */
+std::vector<int> make_lookups(const std::vector<int>& keys, int lookups, bool zipf, std::mt19937& generator) {
+    std::vector<double> cumulative(keys.size());
+    double total = 0;
+    for(std::size_t i = 0; i < keys.size(); ++i) {
+        total += zipf ? 1 / std::pow(i + 1.0, 1.1) : 1;
+        cumulative[i] = total;
+    }
+    std::uniform_real_distribution<double> pick(0, total);
+    std::vector<int> result(lookups);
+    for(int i = 0; i < lookups; ++i) {
+        std::size_t rank = std::lower_bound(cumulative.begin(), cumulative.end(), pick(generator)) - cumulative.begin();
+        result[i] = keys[std::min(rank, keys.size() - 1)];
+    }
+    return result;
+}
+
+/** Compares the PLAIN and SPLAY policies for count() on uniform and Zipf lookups, for a tree built from shuffled keys (close to balanced) and one built from sorted keys (a single long path)
+ */
+void benchmark_splay() {
+    std::cout << "count() lookups, PLAIN vs SPLAY (Mops/s)" << std::endl;
+    std::mt19937 generator(7);
+    for(int sorted = 0; sorted < 2; ++sorted) {
+        //a tree from sorted inserts is a path, keep it small enough for the recursive insert of PLAIN
+        int size = sorted ? 20000 : 200000;
+        //PLAIN walks the whole path on every lookup of the sorted tree, so it gets fewer lookups
+        int lookups = sorted ? 100000 : 1000000;
+        std::vector<int> keys(size);
+        for(int i = 0; i < size; ++i) {
+            keys[i] = 3 * i;
+        }
+        std::vector<int> insert_order(keys);
+        if(!sorted) {
+            std::shuffle(insert_order.begin(), insert_order.end(), generator);
+        }
+        //the Zipf ranks are given to the keys in random order so hot keys are spread over the tree
+        std::vector<int> ranked(keys);
+        std::shuffle(ranked.begin(), ranked.end(), generator);
+        std::vector<int> uniform = make_lookups(ranked, lookups, false, generator);
+        std::vector<int> zipf = make_lookups(ranked, lookups, true, generator);
+
+        for(int policy = 0; policy < 2; ++policy) {
+            BinarySearchTree tree(policy ? BinarySearchTree::SPLAY : BinarySearchTree::PLAIN);
+            for(std::size_t i = 0; i < insert_order.size(); ++i) {
+                tree.insert(insert_order[i]);
+            }
+            //the hits of a single repetition are kept, every lookup is of a key in the tree so both equal lookups
+            long uniform_hits = 0;
+            long zipf_hits = 0;
+            double uniform_seconds = best_seconds([&]() {
+                long hits = 0;
+                for(std::size_t i = 0; i < uniform.size(); ++i) {
+                    hits += tree.count(uniform[i]);
+                }
+                uniform_hits = hits;
+            });
+            double zipf_seconds = best_seconds([&]() {
+                long hits = 0;
+                for(std::size_t i = 0; i < zipf.size(); ++i) {
+                    hits += tree.count(zipf[i]);
+                }
+                zipf_hits = hits;
+            });
+            std::cout << "  " << std::setw(8) << (sorted ? "sorted" : "shuffled") << " " << std::setw(6) << size << " keys  "
+                      << (policy ? "SPLAY" : "PLAIN") << "  uniform " << std::fixed << std::setprecision(2) << lookups / uniform_seconds / 1e6
+                      << "  zipf " << lookups / zipf_seconds / 1e6 << "  (hits " << uniform_hits << " / " << zipf_hits << ")" << std::endl;
+        }
+    }
+}
+
+/** Compares the ways of expiring a window of values, erasing the lower half of a tree built from shuffled keys: one erase(int data) per value, a single erase(lo, hi), a single erase_many, and lazy erase followed by compact in batches of 4096.  Only the erasing is timed, each repetition starts from a freshly built tree.
+ */
+void benchmark_erase() {
+    std::cout << "erasing the lower half of a shuffled tree (ms)" << std::endl;
+    std::mt19937 generator(3);
+    const int size = 200000;
+    const int window = size / 2;
+    std::vector<int> insert_order(size);
+    for(int i = 0; i < size; ++i) {
+        insert_order[i] = i;
+    }
+    std::shuffle(insert_order.begin(), insert_order.end(), generator);
+    std::vector<int> expired(window);
+    for(int i = 0; i < window; ++i) {
+        expired[i] = i;
+    }
+    const char* names[] = { "erase(data) per value", "erase(lo, hi)", "erase_many", "lazy erase + compact(4096)" };
+    
+    for(int method = 0; method < 4; ++method) {
+        double best = 0;
+        for(int repeat = 0; repeat < REPEATS; ++repeat) {
+            BinarySearchTree tree;
+            for(std::size_t i = 0; i < insert_order.size(); ++i) {
+                tree.insert(insert_order[i]);
+            }
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if(method == 0) {
+                for(std::size_t i = 0; i < expired.size(); ++i) {
+                    tree.erase(expired[i]);
+                }
+            }
+            else if(method == 1) {
+                tree.erase(0, window - 1);
+            }
+            else if(method == 2) {
+                tree.erase_many(expired);
+            }
+            else {
+                tree.set_lazy_erase(true);
+                for(std::size_t i = 0; i < expired.size(); ++i) {
+                    tree.erase(expired[i]);
+                }
+                //reclaim the marked TreeNodes a batch at a time, as a background task would
+                while(tree.compact(4096) > 0) {
+                }
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            //keep the fastest repetition
+            if(repeat == 0 || seconds < best) {
+                best = seconds;
+            }
+            //every method must leave the upper half
+            if(tree.smallest() != window) {
+                std::cout << "  " << names[method] << " left the wrong values" << std::endl;
+            }
+        }
+        std::cout << "  " << std::setw(28) << std::left << names[method] << std::right << std::fixed << std::setprecision(1) << best * 1000 << std::endl;
+    }
+}
+
+/** Compares the BinarySearchTree and the CompressedSet on sets of 200000 int values spread out in four ways: sparse over all int values, clustered in stretches of 1000 consecutive values, half of the values of a range, and every value of a range.  Reports the bytes per value (both counting what the heap adds to each allocation with ChunkContainer::heap_bytes), the time to insert every value, the rate of count() on random values of the range, and for the CompressedSet the time of intersection_size with a shifted copy of itself.
+ */
+void benchmark_compressed() {
+    std::cout << "BinarySearchTree vs CompressedSet (bytes/value, insert ms, count Mops/s, intersection_size us)" << std::endl;
+    std::mt19937 generator(11);
+    const int size = 200000;
+    const int lookups = 1000000;
+    const char* names[] = { "sparse", "clustered", "half-full", "dense" };
+    
+    for(int spread = 0; spread < 4; ++spread) {
+        std::vector<int> keys;
+        //sparse, random values anywhere in the int range
+        if(spread == 0) {
+            std::uniform_int_distribution<int> pick(INT_MIN, INT_MAX);
+            while(static_cast<int>(keys.size()) < size) {
+                keys.push_back(pick(generator));
+            }
+        }
+        //clustered, stretches of 1000 consecutive values with gaps of 100000 between them
+        else if(spread == 1) {
+            for(int cluster = 0; cluster < size / 1000; ++cluster) {
+                for(int i = 0; i < 1000; ++i) {
+                    keys.push_back(cluster * 100000 + i);
+                }
+            }
+        }
+        //half-full, every value of a range is kept with probability one half
+        else if(spread == 2) {
+            for(int i = 0; static_cast<int>(keys.size()) < size; ++i) {
+                if(generator() % 2 == 0) {
+                    keys.push_back(i);
+                }
+            }
+        }
+        //dense, every value of a range
+        else {
+            for(int i = 0; i < size; ++i) {
+                keys.push_back(i);
+            }
+        }
+        int lowest = *std::min_element(keys.begin(), keys.end());
+        int highest = *std::max_element(keys.begin(), keys.end());
+        //inserted in random order so the BinarySearchTree stays close to balanced
+        std::shuffle(keys.begin(), keys.end(), generator);
+        std::uniform_int_distribution<int> pick(lowest, highest);
+        std::vector<int> probes(lookups);
+        for(int i = 0; i < lookups; ++i) {
+            probes[i] = pick(generator);
+        }
+        
+        BinarySearchTree tree;
+        CompressedSet compressed;
+        double tree_insert = best_seconds([&]() {
+            BinarySearchTree filled;
+            for(std::size_t i = 0; i < keys.size(); ++i) {
+                filled.insert(keys[i]);
+            }
+            filled.swap(tree);
+        });
+        double compressed_insert = best_seconds([&]() {
+            CompressedSet filled;
+            for(std::size_t i = 0; i < keys.size(); ++i) {
+                filled.insert(keys[i]);
+            }
+            filled.optimize();
+            filled.swap(compressed);
+        });
+        //the hits of a single repetition are kept, both structures hold the same values so they must match
+        long tree_hits = 0;
+        long compressed_hits = 0;
+        double tree_count = best_seconds([&]() {
+            long hits = 0;
+            for(std::size_t i = 0; i < probes.size(); ++i) {
+                hits += tree.count(probes[i]);
+            }
+            tree_hits = hits;
+        });
+        double compressed_count = best_seconds([&]() {
+            long hits = 0;
+            for(std::size_t i = 0; i < probes.size(); ++i) {
+                hits += compressed.count(probes[i]);
+            }
+            compressed_hits = hits;
+        });
+        //intersect with the same values moved up by 7, so the chunks overlap without being equal
+        CompressedSet shifted;
+        for(std::size_t i = 0; i < keys.size(); ++i) {
+            shifted.insert(keys[i] + 7);
+        }
+        shifted.optimize();
+        std::size_t common = 0;
+        double intersect = best_seconds([&]() {
+            common = compressed.intersection_size(shifted);
+        });
+        
+        //every TreeNode is its own heap allocation, and sparse values may repeat so count the distinct ones
+        double values = static_cast<double>(compressed.size());
+        double tree_bytes = (sizeof(BinarySearchTree) + values * ChunkContainer::heap_bytes(sizeof(TreeNode))) / values;
+        double compressed_bytes = compressed.memory_usage() / values;
+        std::cout << "  " << std::setw(9) << names[spread] << std::fixed << std::setprecision(3)
+                  << "  tree " << std::setw(6) << tree_bytes << " B " << std::setprecision(2) << std::setw(7) << tree_insert * 1000 << " ms " << std::setw(6) << lookups / tree_count / 1e6
+                  << "  |  compressed " << std::setprecision(3) << std::setw(6) << compressed_bytes << " B " << std::setprecision(2) << std::setw(7) << compressed_insert * 1000 << " ms " << std::setw(6) << lookups / compressed_count / 1e6
+                  << "  " << std::setw(8) << intersect * 1e6 << " us  (hits " << tree_hits << " / " << compressed_hits << ", common " << common << " of " << compressed.size() << ")" << std::endl;
+    }
+}
+
+int main() {
+    benchmark_splay();
+    benchmark_erase();
+    benchmark_compressed();
+    return 0;
+}
@@ -5,8 +5,10 @@
  */
 
 #include <iostream>
+#include <vector>
 #include "TreeNode.h"
 #include "BinarySearchTree.h"
+#include "CompressedSet.h"
 
 int main() {
     
@@ -46,5 +48,72 @@ int main() {
     for(auto x : deep_copy) std::cout << x << ",";
     std::cout << std::endl;
     
+    // Inserting sorted values would make one long path; with the SPLAY policy
+    // deep accesses move TreeNodes up, so the tree does not stay that way.
+    BinarySearchTree splayed(BinarySearchTree::SPLAY);
+    for(int i = 1; i <= 100; ++i)   splayed.insert(i);
+    
+    // Looks up 1 again and again, prints "1 is in the splayed tree."
+    int found = 0;
+    for(int i = 0; i < 20; ++i)   found += splayed.count(1);
+    if(found == 20) std::cout << 1 << " is in the splayed tree." << std::endl;
+    
+    // Prints 0, 100 is not in splayed after erasing it; the order is unchanged
+    splayed.erase(100);
+    std::cout << splayed.count(100) << std::endl;
+    
+    // Prints to the console: 1,2,3,
+    auto first = splayed.begin();
+    std::cout << *first++ << ",";
+    std::cout << *first++ << ",";
+    std::cout << *first << "," << std::endl;
+    
+    // Give a tree the values {1,2,...,20}
+    BinarySearchTree window;
+    for(int i = 1; i <= 20; ++i)   window.insert(i);
+    
+    window.erase(1, 10);                        //  {11,...,20}, a whole range at once
+    window.erase_many(std::vector<int>{12, 14, 16, 30});   //  {11,13,15,17,18,19,20}, 30 is not there
+    
+    // Prints to the console: 11,13,15,17,18,19,20,
+    for(auto x : window)   std::cout << x << ",";
+    std::cout << std::endl;
+    
+    // With lazy erase, erase only marks values; they are skipped but still take memory
+    window.set_lazy_erase(true);
+    window.erase(17);   window.erase(19);
+    
+    // Prints to the console: 11,13,15,18,20, and then 0
+    for(auto x : window)   std::cout << x << ",";
+    std::cout << std::endl << window.count(17) << std::endl;
+    
+    // Reclaims the marked values one at a time, prints 1 and then 1
+    std::cout << window.compact(1) << std::endl;
+    std::cout << window.compact(1) << std::endl;
+    
+    // A CompressedSet has the same functions, give it {-5,2,3,5,70000}
+    CompressedSet compressed;
+    compressed.insert(3);   compressed.insert(-5);  compressed.insert(70000);
+    compressed.insert(5);   compressed.insert(2);   compressed.insert(3);
+    
+    // Prints to the console: -5,2,3,5,70000,
+    for(auto x : compressed)   std::cout << x << ",";
+    std::cout << std::endl;
+    
+    compressed.erase(70000);    //  {-5,2,3,5}
+    
+    // Prints to the console: -5,5,0
+    std::cout << compressed.smallest() << "," << compressed.largest() << "," << compressed.count(70000) << std::endl;
+    
+    // Give a second CompressedSet the values {0,1,...,9999} and store them as a single run
+    CompressedSet range;
+    for(int i = 0; i < 10000; ++i)   range.insert(i);
+    range.optimize();
+    range.erase(3);     //  the run is split in two, {0,1,2,4,...,9999}
+    
+    // Prints to the console: 2,5, and then 2
+    for(auto x : compressed.intersection(range))   std::cout << x << ",";
+    std::cout << std::endl << compressed.intersection_size(range) << std::endl;
+    
     return 0;
 }